@@ -0,0 +1,96 @@
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/to_sql_string.h>
+#include <sqlpp20_bench/measure.h>
+#include <sqlpp20_test/mock_db.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using ::sqlpp::bench::measure;
+using ::sqlpp::bench::report_speedup;
+using ::sqlpp::test::mock_context_t;
+
+namespace {
+// The character-by-character loop sqlpp20 used before, for comparison.
+auto escape_char_by_char(std::string& sql, const std::string_view& s) -> void {
+  sql.push_back('\'');
+  for (const auto c : s) {
+    if (c == '\'') sql.push_back(c);
+    sql.push_back(c);
+  }
+  sql.push_back('\'');
+}
+
+// Text with roughly one quote per 200 characters, like names and prose.
+auto make_texts(std::size_t size, std::size_t count) {
+  auto engine = std::mt19937{42};
+  auto letter = std::uniform_int_distribution<int>{'a', 'z'};
+  auto quote = std::uniform_int_distribution<int>{0, 199};
+  auto texts = std::vector<std::string>(count);
+  for (auto& text : texts) {
+    for (auto i = std::size_t{0}; i < size; ++i) {
+      text.push_back(quote(engine) == 0 ? '\''
+                                        : static_cast<char>(letter(engine)));
+    }
+  }
+  return texts;
+}
+}  // namespace
+
+int main() {
+  constexpr auto text_count = std::size_t{1000};
+
+  // Serialize many literals of a given size into one buffer, as a multi-row
+  // insert does.
+  for (const auto size : {std::size_t{8}, std::size_t{32}, std::size_t{128},
+                          std::size_t{1024}, std::size_t{16384}}) {
+    const auto texts = make_texts(size, text_count);
+    const auto iterations = std::max(std::size_t{1}, 20000 / size);
+    auto sql = std::string{};
+
+    const auto label = std::to_string(size) + " bytes";
+    const auto before = measure(label + " (char by char)", iterations, [&] {
+      sql.clear();
+      for (const auto& text : texts) {
+        escape_char_by_char(sql, text);
+      }
+      return sql.size();
+    });
+    const auto after = measure(label + " (block scan)", iterations, [&] {
+      auto context = mock_context_t{};
+      sql.clear();
+      for (const auto& text : texts) {
+        serialize(context, sql, std::string_view{text});
+      }
+      return sql.size();
+    });
+    report_speedup(before, after);
+  }
+}
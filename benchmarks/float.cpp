@@ -0,0 +1,119 @@
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/operator.h>
+#include <sqlpp20_bench/measure.h>
+#include <sqlpp20_test/mock_db.h>
+#include <sqlpp20_test/tables/TabFloat.h>
+
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+using ::sqlpp::bench::measure;
+using ::sqlpp::bench::report_speedup;
+using ::sqlpp::test::mock_context_t;
+using test::tabFloat;
+
+namespace bench {
+// Formats floating point values the way sqlpp20 did before switching to
+// std::to_chars, for comparison.
+struct stream_context_t : public ::sqlpp::context_base {};
+
+template <typename T>
+requires(std::is_floating_point_v<T>) auto serialize(stream_context_t&,
+                                                     std::string& sql,
+                                                     const T& f) -> void {
+  auto oss = std::ostringstream{};
+  oss << std::setprecision(std::numeric_limits<long double>::digits10 + 1)
+      << f;
+  sql += oss.str();
+}
+}  // namespace bench
+
+int main() {
+  constexpr auto row_count = std::size_t{1000};
+  constexpr auto insert_iterations = std::size_t{200};
+  constexpr auto bind_iterations = std::size_t{1000000};
+
+  auto engine = std::mt19937_64{42};
+  auto distribution = std::uniform_real_distribution<double>{-1e6, 1e6};
+
+  using row_t = std::tuple<decltype(tabFloat.valueFloat = float{}),
+                           decltype(tabFloat.valueDouble = double{})>;
+  auto rows = std::vector<row_t>{};
+  auto values = std::vector<double>{};
+  for (auto i = std::size_t{0}; i < row_count; ++i) {
+    const auto d = distribution(engine);
+    values.push_back(d);
+    rows.push_back(row_t{tabFloat.valueFloat = static_cast<float>(d),
+                         tabFloat.valueDouble = d});
+  }
+  const auto insert = insert_into(tabFloat).multiset(rows);
+
+  // Bulk insert of float and double columns
+  {
+    auto sql = std::string{};
+    const auto before = measure("insert 1000 rows (ostringstream)",
+                                insert_iterations, [&] {
+                                  auto context = bench::stream_context_t{};
+                                  sql.clear();
+                                  serialize(context, sql, insert);
+                                  return sql.size();
+                                });
+    const auto after =
+        measure("insert 1000 rows (to_chars)", insert_iterations, [&] {
+          auto context = mock_context_t{};
+          sql.clear();
+          serialize(context, sql, insert);
+          return sql.size();
+        });
+    report_speedup(before, after);
+  }
+
+  // Text protocol parameter binding, one value at a time (as in postgresql)
+  {
+    auto parameter_string = std::string{};
+    auto index = std::size_t{0};
+    const auto before =
+        measure("bind double (ostringstream)", bind_iterations, [&] {
+          parameter_string = to_sql_string_c(bench::stream_context_t{},
+                                             values[++index % row_count]);
+          return parameter_string.size();
+        });
+    const auto after = measure("bind double (to_chars)", bind_iterations, [&] {
+      auto context = mock_context_t{};
+      parameter_string.clear();
+      serialize(context, parameter_string, values[++index % row_count]);
+      return parameter_string.size();
+    });
+    report_speedup(before, after);
+  }
+}
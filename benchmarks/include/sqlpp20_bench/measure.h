@@ -0,0 +1,68 @@
+#pragma once
+
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+namespace sqlpp::bench {
+// Calls `function` `iterations` times and prints the time per call and the
+// throughput. `function` returns the number of bytes it produced, which is
+// also used to keep the compiler from optimizing the work away.
+template <typename Function>
+auto measure(std::string_view name, std::size_t iterations, Function function)
+    -> std::chrono::nanoseconds {
+  auto bytes = std::size_t{0};
+  const auto start = std::chrono::steady_clock::now();
+  for (auto i = std::size_t{0}; i < iterations; ++i) {
+    bytes += function();
+  }
+  const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start);
+
+  const auto ns_per_call =
+      static_cast<double>(duration.count()) / static_cast<double>(iterations);
+  const auto mb_per_second = static_cast<double>(bytes) * 1e3 /
+                             static_cast<double>(duration.count());
+  std::cout << std::left << std::setw(48) << name << std::right
+            << std::setw(14) << std::fixed << std::setprecision(1)
+            << ns_per_call << " ns/call" << std::setw(10) << mb_per_second
+            << " MB/s\n";
+  return duration;
+}
+
+inline auto report_speedup(std::chrono::nanoseconds before,
+                           std::chrono::nanoseconds after) -> void {
+  std::cout << "speedup: " << std::fixed << std::setprecision(2)
+            << static_cast<double>(before.count()) /
+                   static_cast<double>(after.count())
+            << "x\n\n";
+}
+}  // namespace sqlpp::bench
@@ -0,0 +1,118 @@
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/mysql/connection.h>
+#include <sqlpp20/mysql_test/get_config.h>
+#include <sqlpp20/parameter.h>
+#include <sqlpp20/transaction.h>
+#include <sqlpp20_test/tables/TabFloat.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using test::tabFloat;
+
+namespace {
+// Calls `insert` with the number of rows to insert, within a transaction, and
+// prints the throughput
+template <typename Db, typename Insert>
+auto measure_insert(Db& db, std::string_view name, std::size_t row_count,
+                    Insert insert) -> void {
+  db(drop_table(tabFloat));
+  db(create_table(tabFloat));
+
+  const auto start = std::chrono::steady_clock::now();
+  auto tx = start_transaction(db);
+  insert(row_count);
+  tx.commit();
+  const auto duration = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start);
+
+  std::cout << std::left << std::setw(40) << name << std::right
+            << std::setw(10) << row_count << " rows" << std::setw(12)
+            << std::fixed << std::setprecision(0)
+            << static_cast<double>(row_count) / duration.count()
+            << " rows/s\n";
+}
+}  // namespace
+
+namespace mysql = sqlpp::mysql;
+int main(int argc, char** argv) {
+  const auto row_count =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{100000};
+  try {
+    mysql::global_library_init();
+    auto config = mysql::test::get_config();
+    config.debug = nullptr;
+    auto db = mysql::connection_t<sqlpp::debug::none>{config};
+
+    measure_insert(db, "prepared, one row per execution", row_count,
+                   [&](std::size_t count) {
+                     auto prepared = db.prepare(insert_into(tabFloat).set(
+                         tabFloat.valueFloat =
+                             sqlpp::parameter<float>(tabFloat.valueFloat),
+                         tabFloat.valueDouble =
+                             sqlpp::parameter<double>(tabFloat.valueDouble)));
+                     for (auto i = std::size_t{0}; i < count; ++i) {
+                       prepared.parameters.valueFloat = static_cast<float>(i);
+                       prepared.parameters.valueDouble =
+                           static_cast<double>(i);
+                       execute(prepared);
+                     }
+                   });
+
+    for (const auto batch_size : {std::size_t{100}, std::size_t{1000}}) {
+      measure_insert(
+          db, "prepared, batches of " + std::to_string(batch_size) + " rows",
+          row_count, [&](std::size_t count) {
+            auto prepared = db.prepare(insert_into(tabFloat).set(
+                tabFloat.valueFloat =
+                    sqlpp::parameter<float>(tabFloat.valueFloat),
+                tabFloat.valueDouble =
+                    sqlpp::parameter<double>(tabFloat.valueDouble)));
+            auto parameter_sets =
+                std::vector<decltype(prepared.parameters)>(count);
+            for (auto i = std::size_t{0}; i < count; ++i) {
+              parameter_sets[i].valueFloat = static_cast<float>(i);
+              parameter_sets[i].valueDouble = static_cast<double>(i);
+            }
+            prepared.execute_batch(parameter_sets, batch_size);
+          });
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
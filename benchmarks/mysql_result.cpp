@@ -0,0 +1,164 @@
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/mysql/connection.h>
+#include <sqlpp20/mysql_test/get_config.h>
+#include <sqlpp20_test/tables/TabFloat.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <sys/resource.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+using test::tabFloat;
+using test::tabPerson;
+
+namespace {
+// Peak resident set size of the process so far, in MB
+auto peak_rss_mb() -> double {
+  auto usage = rusage{};
+  getrusage(RUSAGE_SELF, &usage);
+  return static_cast<double>(usage.ru_maxrss) / 1024.0;
+}
+
+// Reads all rows of the result returned by `execute` and prints the time to
+// the first row, the total time and the peak memory usage of the process.
+// The peak can only grow, so modes with bounded memory have to run first.
+template <typename Execute>
+auto read_all(std::string_view name, Execute execute) -> void {
+  const auto start = std::chrono::steady_clock::now();
+  auto first_row = std::chrono::steady_clock::duration{};
+  auto rows = std::size_t{0};
+  for ([[maybe_unused]] const auto& row : execute()) {
+    if (rows++ == 0) {
+      first_row = std::chrono::steady_clock::now() - start;
+    }
+  }
+  const auto total = std::chrono::steady_clock::now() - start;
+
+  using std::chrono::duration_cast;
+  using std::chrono::milliseconds;
+  std::cout << std::left << std::setw(36) << name << std::right
+            << std::setw(10) << rows << " rows" << std::setw(10)
+            << duration_cast<milliseconds>(first_row).count()
+            << " ms to first row" << std::setw(10)
+            << duration_cast<milliseconds>(total).count() << " ms total"
+            << std::setw(10) << std::fixed << std::setprecision(1)
+            << peak_rss_mb() << " MB peak RSS\n";
+}
+}  // namespace
+
+namespace mysql = sqlpp::mysql;
+int main(int argc, char** argv) {
+  const auto row_count =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{1000000};
+  try {
+    mysql::global_library_init();
+    auto config = mysql::test::get_config();
+    config.debug = nullptr;
+    auto db = mysql::connection_t<sqlpp::debug::none>{config};
+
+    db(drop_table(tabFloat));
+    db(create_table(tabFloat));
+    using row_t = std::tuple<decltype(tabFloat.valueFloat = float{}),
+                             decltype(tabFloat.valueDouble = double{})>;
+    auto rows = std::vector<row_t>{};
+    for (auto i = std::size_t{0}; i < row_count; ++i) {
+      const auto d = static_cast<double>(i);
+      rows.push_back(row_t{tabFloat.valueFloat = static_cast<float>(d),
+                           tabFloat.valueDouble = d});
+      if (rows.size() == 1000 or i + 1 == row_count) {
+        db(insert_into(tabFloat).multiset(rows));
+        rows.clear();
+      }
+    }
+    rows.shrink_to_fit();
+    std::cout << "baseline" << std::setw(90) << std::fixed
+              << std::setprecision(1) << peak_rss_mb() << " MB peak RSS\n";
+
+    const auto select_all =
+        select(tabFloat.id, tabFloat.valueFloat, tabFloat.valueDouble)
+            .from(tabFloat)
+            .unconditionally();
+    auto prepared_cursor = db.prepare(select_all);
+    prepared_cursor.use_cursor(1000);
+    auto prepared_buffered = db.prepare(select_all);
+
+    read_all("direct, unbuffered (stream)",
+             [&] { return db.stream(select_all); });
+    read_all("prepared, cursor (prefetch 1000)",
+             [&] { return execute(prepared_cursor); });
+    read_all("direct, buffered", [&] { return db(select_all); });
+    read_all("prepared, buffered",
+             [&] { return execute(prepared_buffered); });
+
+    // Wide varchar columns, which need large result buffers
+    db(drop_table(tabPerson));
+    db(create_table(tabPerson));
+    using person_t = std::tuple<decltype(tabPerson.isManager = bool{}),
+                                decltype(tabPerson.name = std::string{}),
+                                decltype(tabPerson.address = std::string{})>;
+    auto persons = std::vector<person_t>{};
+    const auto person_count = row_count / 10;
+    for (auto i = std::size_t{0}; i < person_count; ++i) {
+      persons.push_back(person_t{
+          tabPerson.isManager = (i % 10 == 0),
+          tabPerson.name = std::string(100 + i % 100, 'n'),
+          tabPerson.address = std::string(150 + i % 100, 'a')});
+      if (persons.size() == 1000 or i + 1 == person_count) {
+        db(insert_into(tabPerson).multiset(persons));
+        persons.clear();
+      }
+    }
+
+    const auto select_persons =
+        select(tabPerson.name, tabPerson.address, tabPerson.language)
+            .from(tabPerson)
+            .unconditionally();
+    auto persons_cursor = db.prepare(select_persons);
+    persons_cursor.use_cursor(1000);
+    auto persons_buffered = db.prepare(select_persons);
+    read_all("prepared varchar, cursor",
+             [&] { return execute(persons_cursor); });
+    read_all("prepared varchar, buffered",
+             [&] { return execute(persons_buffered); });
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,179 @@
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/clause/with.h>
+#include <sqlpp20/cte.h>
+#include <sqlpp20/name_tag.h>
+#include <sqlpp20/operator.h>
+#include <sqlpp20/parameter.h>
+#include <sqlpp20/to_sql_string.h>
+#include <sqlpp20_bench/measure.h>
+#include <sqlpp20_test/mock_db.h>
+#include <sqlpp20_test/tables/TabDepartment.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#ifdef SQLPP20_BENCH_SQLITE3
+#include <sqlpp20/sqlite3/connection.h>
+#endif
+#ifdef SQLPP20_BENCH_POSTGRESQL
+#include <sqlpp20/postgresql/connection.h>
+#endif
+#ifdef SQLPP20_BENCH_MYSQL
+#include <sqlpp20/mysql/connection.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+using ::sqlpp::bench::measure;
+using ::test::tabDepartment;
+using ::test::tabPerson;
+
+// Count heap allocations, so that the benchmark can report them per
+// statement.
+namespace {
+auto allocation_count = std::size_t{0};
+}  // namespace
+
+auto operator new(std::size_t size) -> void* {
+  ++allocation_count;
+  if (auto* p = std::malloc(size == 0 ? 1 : size)) return p;
+  throw std::bad_alloc{};
+}
+
+auto operator delete(void* p) noexcept -> void { std::free(p); }
+
+auto operator delete(void* p, std::size_t) noexcept -> void { std::free(p); }
+
+SQLPP_CREATE_NAME_TAG(cte_manager);
+
+namespace {
+// Serializes `statement` into a fresh string, like the connectors do, and
+// reports the time, throughput and allocations per statement.
+template <typename Context, typename Statement>
+auto measure_statement(const std::string& name, std::size_t iterations,
+                       const Statement& statement) -> void {
+  const auto allocations_before = allocation_count;
+  measure(name, iterations, [&] {
+    return to_sql_string_c(Context{}, statement).size();
+  });
+  std::cout << std::string(48, ' ') << std::fixed << std::setprecision(1)
+            << std::setw(14)
+            << static_cast<double>(allocation_count - allocations_before) /
+                   static_cast<double>(iterations)
+            << " allocations/call\n";
+}
+
+template <std::size_t... Is>
+auto long_in_list(std::index_sequence<Is...>) {
+  return sqlpp::select(tabPerson.id, tabPerson.name)
+      .from(tabPerson)
+      .where(in(tabPerson.id, static_cast<std::int64_t>(Is * 7919)...));
+}
+
+auto make_rows(std::size_t count) {
+  using row_t = std::tuple<decltype(tabPerson.isManager = true),
+                           decltype(tabPerson.name = std::string{})>;
+  auto rows = std::vector<row_t>{};
+  rows.reserve(count);
+  for (auto i = std::size_t{0}; i < count; ++i) {
+    rows.emplace_back(tabPerson.isManager = (i % 2 == 0),
+                      tabPerson.name = "Person " + std::to_string(i));
+  }
+  return rows;
+}
+
+template <typename Context>
+auto run_suite(const std::string& context_name) -> void {
+  std::cout << "context: " << context_name << '\n';
+
+  measure_statement<Context>(
+      "wide select", 100000,
+      sqlpp::select(tabPerson.id, tabPerson.isManager, tabPerson.name,
+                    tabPerson.address, tabPerson.language)
+          .from(tabPerson)
+          .where(tabPerson.isManager and tabPerson.name != "" and
+                 tabPerson.id > 17)
+          .order_by(tabPerson.id.asc())
+          .limit(10u)
+          .offset(20u));
+
+  measure_statement<Context>(
+      "join", 100000,
+      sqlpp::select(tabPerson.id, tabPerson.name, tabDepartment.name.as(
+                                                      cte_manager))
+          .from(tabPerson.join(tabDepartment)
+                    .on(tabPerson.id == tabDepartment.id))
+          .where(tabPerson.name ==
+                 sqlpp::parameter<std::string>(tabPerson.name)));
+
+  measure_statement<Context>(
+      "cte", 100000,
+      sqlpp::with(cte(cte_manager)
+                      .as(sqlpp::select(all_of(tabPerson))
+                              .from(tabPerson)
+                              .where(tabPerson.isManager)))
+          << sqlpp::select()
+          << sqlpp::select_columns(tabPerson.id, tabPerson.name)
+          << sqlpp::from(tabPerson)
+          << sqlpp::where(tabPerson.id % 2 == 0));
+
+  measure_statement<Context>("in() with 256 values", 10000,
+                             long_in_list(std::make_index_sequence<256>{}));
+
+  for (const auto row_count :
+       {std::size_t{10}, std::size_t{1000}, std::size_t{100000}}) {
+    measure_statement<Context>(
+        "insert " + std::to_string(row_count) + " rows",
+        std::max(std::size_t{1}, 1000000 / row_count),
+        insert_into(tabPerson).multiset(make_rows(row_count)));
+  }
+  std::cout << '\n';
+}
+}  // namespace
+
+int main() {
+  run_suite<::sqlpp::test::mock_context_t>("mock");
+#ifdef SQLPP20_BENCH_SQLITE3
+  run_suite<::sqlpp::sqlite3::context_t>("sqlite3");
+#endif
+#ifdef SQLPP20_BENCH_POSTGRESQL
+  run_suite<::sqlpp::postgresql::context_t>("postgresql");
+#endif
+#ifdef SQLPP20_BENCH_MYSQL
+  run_suite<::sqlpp::mysql::context_t>("mysql");
+#endif
+}
@@ -0,0 +1,232 @@
+#pragma once
+
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/insert_values.h>
+#include <sqlpp20/mysql/context.h>
+#include <sqlpp20/mysql/mysql.h>
+#include <sqlpp20/prepared_statement_parameters.h>
+#include <sqlpp20/type_traits.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// MariaDB Connector/C binds arrays of parameter values, which are sent to the
+// server in a single round trip (COM_STMT_BULK_EXECUTE).
+// Note: The usage tests run against MySQL, so this path is not covered by them.
+#if defined(MARIADB_PACKAGE_VERSION_ID) && MARIADB_PACKAGE_VERSION_ID >= 30000
+#define SQLPP_MYSQL_ARRAY_BINDING 1
+#endif
+
+namespace sqlpp::mysql::detail {
+// Returns the values of an insert statement, e.g. "(?, ?)". Appending them
+// repeatedly turns the statement into a multi-row insert, if they hold all of
+// the statement's parameters. Otherwise, the result is empty.
+template <typename ParameterVector, typename Statement, typename... Assignments>
+auto values_row(
+    context_t& context,
+    const clause_base<insert_values_t<Assignments...>, Statement>& clause)
+    -> std::string {
+  auto sql = std::string{};
+  if constexpr (parameters_of_t<insert_values_t<Assignments...>>::size() ==
+                ParameterVector::size()) {
+    ::sqlpp::detail::serialize_values_row(context, sql, clause._assignments);
+  }
+  return sql;
+}
+}  // namespace sqlpp::mysql::detail
+
+#ifdef SQLPP_MYSQL_ARRAY_BINDING
+namespace sqlpp::mysql::detail {
+template <typename T>
+struct array_column_t {
+  static_assert(wrong<T>, "Parameter type not supported by array binding");
+};
+
+// Column-wise array of numeric values and NULL indicators
+template <typename T>
+requires(std::is_arithmetic_v<T>) struct array_column_t<T> {
+  // std::vector<bool> cannot be bound
+  using value_t = std::conditional_t<std::is_same_v<T, bool>, signed char, T>;
+
+  std::vector<value_t> values;
+  std::vector<char> indicators;
+
+  auto clear() -> void {
+    values.clear();
+    indicators.clear();
+  }
+
+  auto add(const T& value) -> void {
+    values.push_back(static_cast<value_t>(value));
+    indicators.push_back(STMT_INDICATOR_NONE);
+  }
+
+  auto add(const std::nullopt_t&) -> void {
+    values.push_back(value_t{});
+    indicators.push_back(STMT_INDICATOR_NULL);
+  }
+
+  auto bind(MYSQL_BIND& parameter) -> void {
+    parameter = MYSQL_BIND{};
+    if constexpr (std::is_same_v<T, bool>) {
+      parameter.buffer_type = MYSQL_TYPE_TINY;
+    } else if constexpr (std::is_same_v<T, std::int32_t>) {
+      parameter.buffer_type = MYSQL_TYPE_LONG;
+    } else if constexpr (std::is_same_v<T, std::int64_t>) {
+      parameter.buffer_type = MYSQL_TYPE_LONGLONG;
+    } else if constexpr (std::is_same_v<T, float>) {
+      parameter.buffer_type = MYSQL_TYPE_FLOAT;
+    } else if constexpr (std::is_same_v<T, double>) {
+      parameter.buffer_type = MYSQL_TYPE_DOUBLE;
+    } else {
+      static_assert(wrong<T>, "Parameter type not supported by array binding");
+    }
+    parameter.buffer = values.data();
+    parameter.u.indicator = indicators.data();
+  }
+};
+
+// Column-wise array of pointers to the strings (which are not copied),
+// lengths and NULL indicators
+struct array_string_column_t {
+  std::vector<const char*> values;
+  std::vector<unsigned long> lengths;
+  std::vector<char> indicators;
+
+  auto clear() -> void {
+    values.clear();
+    lengths.clear();
+    indicators.clear();
+  }
+
+  auto add(const std::string_view& value) -> void {
+    values.push_back(value.data());
+    lengths.push_back(value.size());
+    indicators.push_back(STMT_INDICATOR_NONE);
+  }
+
+  auto add(const std::nullopt_t&) -> void {
+    values.push_back(nullptr);
+    lengths.push_back(0);
+    indicators.push_back(STMT_INDICATOR_NULL);
+  }
+
+  auto bind(MYSQL_BIND& parameter) -> void {
+    parameter = MYSQL_BIND{};
+    parameter.buffer_type = MYSQL_TYPE_STRING;
+    parameter.buffer = values.data();
+    parameter.length = lengths.data();
+    parameter.u.indicator = indicators.data();
+  }
+};
+
+template <>
+struct array_column_t<std::string> : array_string_column_t {};
+
+template <>
+struct array_column_t<std::string_view> : array_string_column_t {};
+
+template <typename T>
+struct array_column_t<std::optional<T>> : array_column_t<T> {
+  using array_column_t<T>::add;
+
+  auto add(const std::optional<T>& value) -> void {
+    value ? add(*value) : add(std::nullopt);
+  }
+};
+
+template <typename ParameterVector>
+class array_parameters_t {
+  static_assert(wrong<ParameterVector>,
+                "wrong template argument for array_parameters_t");
+};
+
+// The parameter sets of a batch, arranged for column-wise array binding
+template <typename... ParameterSpecs>
+class array_parameters_t<type_vector<ParameterSpecs...>> {
+  using _parameters_t =
+      ::sqlpp::prepared_statement_parameters<type_vector<ParameterSpecs...>>;
+  static constexpr auto _indexes =
+      std::index_sequence_for<ParameterSpecs...>{};
+
+  std::tuple<array_column_t<value_type_of_t<ParameterSpecs>>...> _columns;
+  std::size_t _size = 0;
+
+  template <std::size_t... Is>
+  auto add(const _parameters_t& parameters, std::index_sequence<Is...>)
+      -> void {
+    (..., std::get<Is>(_columns).add(
+              static_cast<const parameter_base_t<ParameterSpecs>&>(
+                  parameters)()));
+  }
+
+  template <std::size_t... Is>
+  auto bind(std::array<MYSQL_BIND, sizeof...(ParameterSpecs)>& bind_data,
+            std::index_sequence<Is...>) -> void {
+    (..., std::get<Is>(_columns).bind(bind_data[Is]));
+  }
+
+ public:
+  [[nodiscard]] auto size() const -> std::size_t { return _size; }
+
+  auto clear() -> void {
+    std::apply([](auto&... columns) { (..., columns.clear()); }, _columns);
+    _size = 0;
+  }
+
+  auto add(const _parameters_t& parameters) -> void {
+    add(parameters, _indexes);
+    ++_size;
+  }
+
+  // The bindings refer to the arrays until the next call of add() or clear()
+  auto bind(std::array<MYSQL_BIND, sizeof...(ParameterSpecs)>& bind_data)
+      -> void {
+    bind(bind_data, _indexes);
+  }
+};
+
+inline auto supports_array_binding(MYSQL* connection) -> bool {
+  auto capabilities = 0ul;
+  if (mariadb_get_infov(connection,
+                        MARIADB_CONNECTION_EXTENDED_SERVER_CAPABILITIES,
+                        &capabilities)) {
+    return false;
+  }
+  return capabilities & (MARIADB_CLIENT_STMT_BULK_OPERATIONS >> 32);
+}
+}  // namespace sqlpp::mysql::detail
+#endif
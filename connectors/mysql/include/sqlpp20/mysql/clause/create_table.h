@@ -41,71 +41,60 @@ struct context_t;
 
 namespace sqlpp::mysql::detail {
 template <typename ColumnSpec>
-[[nodiscard]] auto to_sql_column_spec_string(mysql::context_t& context,
-                                             const ColumnSpec& columnSpec) {
-  auto ret = to_sql_name(context, columnSpec) +
-             value_type_to_sql_string(
-                 context, type_t<typename ColumnSpec::value_type>{});
+constexpr auto serialize_column_spec(mysql::context_t& context,
+                                     std::string& sql,
+                                     const ColumnSpec& columnSpec) -> void {
+  sql += to_sql_name(context, columnSpec);
+  sql += value_type_to_sql_string(context,
+                                  type_t<typename ColumnSpec::value_type>{});
 
   if constexpr (!ColumnSpec::can_be_null) {
-    ret += " NOT NULL";
+    sql += " NOT NULL";
   }
 
   if constexpr (ColumnSpec::has_auto_increment) {
-    ret += " AUTO_INCREMENT";
+    sql += " AUTO_INCREMENT";
   } else if constexpr (ColumnSpec::has_default_value) {
-    ret += " DEFAULT " + to_sql_string(context, columnSpec.default_value);
+    sql += " DEFAULT ";
+    serialize(context, sql, columnSpec.default_value);
   }
-
-  return ret;
 }
 
 template <typename TableSpec, typename... ColumnSpecs>
-[[nodiscard]] auto to_sql_create_columns_string(
-    mysql::context_t& context,
-    const std::tuple<column_t<TableSpec, ColumnSpecs>...>& t) {
-  struct {
-    bool first = true;
-    [[nodiscard]] auto to_string() -> std::string {
-      if (first) {
-        first = false;
-        return "";
-      } else {
-        return ", ";
-      }
-    }
-  } separator;
-
-  return (std ::string{} + ... +
-          (separator.to_string() +
-           to_sql_column_spec_string(context, ColumnSpecs{})));
+constexpr auto serialize_create_columns(
+    mysql::context_t& context, std::string& sql,
+    const std::tuple<column_t<TableSpec, ColumnSpecs>...>& t) -> void {
+  auto first = true;
+  ((sql += (first ? "" : ", "), first = false,
+    serialize_column_spec(context, sql, ColumnSpecs{})),
+   ...);
 }
 
 template <typename TableSpec>
-[[nodiscard]] auto to_sql_primary_key(mysql::context_t& context,
-                                      const ::sqlpp::table_t<TableSpec>& t) {
+constexpr auto serialize_primary_key(mysql::context_t& context,
+                                     std::string& sql,
+                                     const ::sqlpp::table_t<TableSpec>& t)
+    -> void {
   using _primary_key = typename TableSpec::primary_key;
-  if constexpr (_primary_key::empty()) {
-    return "";
-  } else {
-    return ", PRIMARY KEY (" +
-           type_vector_to_sql_name(context, _primary_key{}) + ")";
+  if constexpr (not _primary_key::empty()) {
+    sql += ", PRIMARY KEY (";
+    serialize_names(context, sql, _primary_key{});
+    sql += ")";
   }
 }
 }  // namespace sqlpp::mysql::detail
 
 namespace sqlpp {
 template <typename Table, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    mysql::context_t& context,
-    const clause_base<create_table_t<Table>, Statement>& t) {
-  auto ret = std::string{"CREATE TABLE "} + to_sql_string(context, t._table);
-  ret += "(";
-  ret += ::sqlpp::mysql::detail::to_sql_create_columns_string(
-      context, column_tuple_of(t._table));
-  ret += ::sqlpp::mysql::detail::to_sql_primary_key(context, t._table);
-  ret += ")";
-
-  return ret;
+constexpr auto serialize(mysql::context_t& context, std::string& sql,
+                         const clause_base<create_table_t<Table>, Statement>& t)
+    -> void {
+  sql += "CREATE TABLE ";
+  serialize(context, sql, t._table);
+  sql += "(";
+  ::sqlpp::mysql::detail::serialize_create_columns(context, sql,
+                                                   column_tuple_of(t._table));
+  ::sqlpp::mysql::detail::serialize_primary_key(context, sql, t._table);
+  sql += ")";
 }
 }  // namespace sqlpp
@@ -30,9 +30,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace sqlpp {
 template <typename Statement>
-[[nodiscard]] auto to_sql_string(
-    mysql::context_t& context,
-    const clause_base<insert_default_values_t, Statement>& t) {
-  return std::string{" () VALUES()"};
+constexpr auto serialize(
+    mysql::context_t& context, std::string& sql,
+    const clause_base<insert_default_values_t, Statement>& t) -> void {
+  sql += " () VALUES()";
+}
+
+template <typename Statement>
+auto sql_length_estimate(
+    const mysql::context_t&,
+    const clause_base<insert_default_values_t, Statement>&) -> std::size_t {
+  return sql_length(" () VALUES()");
 }
 }  // namespace sqlpp
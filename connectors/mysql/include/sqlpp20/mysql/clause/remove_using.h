@@ -48,10 +48,10 @@ template <typename Table, typename Statement>
 class clause_base<using_t<Table>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<using_t<Table>, OtherStatement>& s)
+  constexpr clause_base(const clause_base<using_t<Table>, OtherStatement>& s)
       : _table(s._table) {}
 
-  clause_base(const using_t<Table>& f) : _table(f._table) {}
+  constexpr clause_base(const using_t<Table>& f) : _table(f._table) {}
 
   Table _table;
 };
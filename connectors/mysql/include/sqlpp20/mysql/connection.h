@@ -26,6 +26,7 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/chunked_insert.h>
 #include <sqlpp20/connection.h>
 #include <sqlpp20/mysql/clause.h>
 #include <sqlpp20/mysql/connection_config.h>
@@ -34,10 +35,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlpp20/mysql/mysql.h>
 #include <sqlpp20/mysql/prepared_statement.h>
 #include <sqlpp20/mysql/prepared_statement_result.h>
+#include <sqlpp20/mysql/to_sql_string.h>
 #include <sqlpp20/result.h>
+#include <sqlpp20/sql_string_cache.h>
 #include <sqlpp20/statement.h>
+#include <sqlpp20/static_sql_string.h>
 
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <string_view>
 #include <type_traits>
 
 namespace sqlpp::mysql {
@@ -61,11 +68,18 @@ class connection_cleanup_t {
 using unique_connection_ptr =
     std::unique_ptr<MYSQL, detail::connection_cleanup_t>;
 
+struct connection_busy_t {
+  // Closed after the unbuffered result, if the connection is gone already
+  unique_connection_ptr orphaned_handle;
+};
+
 template <typename Pool, ::sqlpp::debug Debug>
 inline auto execute_query(const base_connection<Pool, Debug>& connection,
                           const std::string& query) -> void {
   detail::thread_init();
 
+  detail::check_not_busy(connection._busy, "query was >>" + query + "<<");
+
   if constexpr (base_connection<Pool, Debug>::is_debug_allowed())
     connection.debug("Executing: '" + query + "'");
 
@@ -94,6 +108,8 @@ class base_connection : public ::sqlpp::connection,
 
   detail::unique_connection_ptr _handle;
   bool _transaction_active = false;
+  detail::connection_busy_state_ptr _busy =
+      std::make_shared<detail::connection_busy_state_t>();
 
   template <typename... Clauses>
   friend class ::sqlpp::statement;
@@ -103,6 +119,13 @@ class base_connection : public ::sqlpp::connection,
 
   friend Pool;
 
+  template <typename ResultType, typename ParameterVector, typename ResultRow>
+  friend class prepared_statement_t;
+
+  template <typename P, ::sqlpp::debug D>
+  friend auto detail::execute_query(const base_connection<P, D>& connection,
+                                    const std::string& query) -> void;
+
   base_connection(const connection_config_t& config,
                   detail::unique_connection_ptr&& handle, Pool* connection_pool)
       : _pool_base{connection_pool},
@@ -115,6 +138,8 @@ class base_connection : public ::sqlpp::connection,
   }
 
  public:
+  using context_type = context_t;
+
   base_connection() = delete;
   base_connection(const connection_config_t& config)
       : _debug_base{config.debug}, _handle(mysql_init(nullptr)) {
@@ -165,6 +190,11 @@ class base_connection : public ::sqlpp::connection,
   base_connection& operator=(const base_connection&) = delete;
   base_connection& operator=(base_connection&&) = default;
   ~base_connection() {
+    // An unbuffered result still reads from the handle, which must neither be
+    // closed nor used by anyone else before the result is freed
+    if (const auto busy = _busy ? _busy->result.lock() : nullptr) {
+      busy->orphaned_handle = std::move(_handle);
+    }
     if constexpr (not std::is_same_v<Pool, no_pool>) {
       if (this->_connection_pool)
         this->_connection_pool->put(std::move(_handle));
@@ -197,6 +227,39 @@ class base_connection : public ::sqlpp::connection,
     }
   }
 
+  // Executes a select without storing its result on the client first: Rows
+  // are transferred while they are read, so memory usage does not grow with
+  // the size of the result. Until the result has been read completely or
+  // destroyed, the connection cannot execute other statements.
+  template <typename... Clauses>
+  [[nodiscard]] auto stream(const ::sqlpp::statement<Clauses...>& statement) {
+    using Statement = ::sqlpp::statement<Clauses...>;
+    if constexpr (constexpr auto _check =
+                      check_statement_executable<base_connection>(
+                          type_v<Statement>);
+                  _check) {
+      static_assert(
+          std::is_same_v<result_type_of_t<Statement>, select_result>,
+          "stream() requires a select statement");
+      this->execute(statement);
+      auto result_handle =
+          detail::unique_result_ptr(mysql_use_result(this->get()), {});
+      if (!result_handle) {
+        throw sqlpp::exception("MySQL: Could not use result set: " +
+                               std::string(mysql_error(this->get())));
+      }
+
+      auto busy = std::make_shared<detail::connection_busy_t>();
+      _busy->result = busy;
+      using _result_type =
+          direct_execution_result_t<result_row_of_t<Statement>>;
+      return ::sqlpp::result_t<_result_type>{
+          _result_type{std::move(result_handle), this->get(), std::move(busy)}};
+    } else {
+      return ::sqlpp::bad_expression_t{_check};
+    }
+  }
+
   template <typename... Clauses>
   auto prepare(const ::sqlpp::statement<Clauses...>& statement) {
     using Statement = ::sqlpp::statement<Clauses...>;
@@ -210,6 +273,32 @@ class base_connection : public ::sqlpp::connection,
     }
   }
 
+  // Prepares a constexpr statement (with static storage duration) using SQL
+  // text that has been generated at compile time.
+  template <const auto& Statement>
+  auto prepare() {
+    using _statement_t = std::remove_cvref_t<decltype(Statement)>;
+    if constexpr (constexpr auto _check =
+                      check_statement_preparable<base_connection>(
+                          type_v<_statement_t>);
+                  _check) {
+      using _prepared_statement_t = ::sqlpp::mysql::prepared_statement_t<
+          result_type_of_t<_statement_t>, parameters_of_t<_statement_t>,
+          result_row_of_t<_statement_t>>;
+      // The text generated at compile time escapes backslashes
+      if (detail::make_context(get()).no_backslash_escapes) {
+        return _prepared_statement_t{*this, Statement};
+      }
+      return _prepared_statement_t{
+          *this,
+          std::string_view{::sqlpp::static_sql_string_v<context_t, Statement>}};
+    } else {
+      return ::sqlpp::bad_expression_t{_check};
+    }
+  }
+
+  auto is_transaction_active() const -> bool { return _transaction_active; }
+
   auto start_transaction() -> void {
     if (_transaction_active) {
       throw sqlpp::exception(
@@ -262,13 +351,39 @@ class base_connection : public ::sqlpp::connection,
 
   auto get() const -> MYSQL* { return _handle.get(); }
 
+  // True while a result of stream() has not been read completely
+  auto is_busy() const -> bool { return _busy and _busy->is_busy(); }
+
   auto is_alive() -> bool { return mysql_ping(_handle.get()) == 0; }
 
+  // Statements must fit into the server's max_allowed_packet
+  auto insert_chunk_limits() const -> insert_chunk_limits_t {
+    detail::execute_query(*this, "SELECT @@max_allowed_packet");
+    const auto result_handle =
+        detail::unique_result_ptr(mysql_store_result(get()), {});
+    const auto row =
+        result_handle ? mysql_fetch_row(result_handle.get()) : nullptr;
+    if (not row or not row[0]) {
+      throw sqlpp::exception("MySQL: Could not read max_allowed_packet: " +
+                             std::string(mysql_error(get())));
+    }
+
+    auto limits = insert_chunk_limits_t{};
+    limits.max_sql_length = std::stoull(row[0]) / 2;
+    return limits;
+  }
+
+  // Rows inserted, updated or deleted by the last such statement (replaced
+  // rows count twice, see mysql_affected_rows)
+  auto affected_rows() const -> std::uint64_t {
+    return mysql_affected_rows(get());
+  }
+
  private:
   template <typename... Clauses>
   auto execute(const ::sqlpp::statement<Clauses...>& statement) {
-    return detail::execute_query(*this,
-                                 to_sql_string_c(context_t{}, statement));
+    return detail::execute_query(
+        *this, to_sql_string_cached(detail::make_context(get()), statement));
   }
 
   template <typename Statement>
@@ -27,7 +27,23 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/context_base.h>
+#include <sqlpp20/mysql/mysql.h>
 
 namespace sqlpp::mysql {
-struct context_t : public ::sqlpp::context_base {};
+struct context_t : public ::sqlpp::context_base {
+  // Set if the session's sql_mode contains NO_BACKSLASH_ESCAPES. Backslashes
+  // in string literals are ordinary characters then.
+  bool no_backslash_escapes = false;
+};
 }  // namespace sqlpp::mysql
+
+namespace sqlpp::mysql::detail {
+// The server reports the sql_mode flag with the status of every statement
+// (see mysql_real_escape_string), so it is up to date after SET sql_mode.
+inline auto make_context(const MYSQL* handle) -> context_t {
+  auto context = context_t{};
+  context.no_backslash_escapes =
+      handle and (handle->server_status & SERVER_STATUS_NO_BACKSLASH_ESCAPES);
+  return context;
+}
+}  // namespace sqlpp::mysql::detail
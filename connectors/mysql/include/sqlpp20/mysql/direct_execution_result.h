@@ -26,6 +26,7 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/exception.h>
 #include <sqlpp20/mysql/mysql.h>
 #include <sqlpp20/result_row.h>
 
@@ -34,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
 
 namespace sqlpp ::mysql::detail {
 struct result_cleanup_t {
@@ -45,6 +47,32 @@ struct result_cleanup_t {
 };
 using unique_result_ptr = std::unique_ptr<MYSQL_RES, result_cleanup_t>;
 
+// Held by unbuffered results (see mysql_use_result): The connection cannot
+// execute other statements until all rows have been fetched or the result has
+// been freed. Defined with the connection, which hands its handle over, if it
+// is destroyed before the result.
+struct connection_busy_t;
+using connection_busy_token = std::shared_ptr<connection_busy_t>;
+
+// Shared by a connection and its prepared statements, which must not be
+// executed while an unbuffered result is pending either
+struct connection_busy_state_t {
+  std::weak_ptr<connection_busy_t> result;
+
+  auto is_busy() const -> bool { return not result.expired(); }
+};
+using connection_busy_state_ptr = std::shared_ptr<connection_busy_state_t>;
+
+inline auto check_not_busy(const connection_busy_state_ptr& busy,
+                           const std::string_view& what) -> void {
+  if (busy and busy->is_busy()) {
+    throw sqlpp::exception(
+        "MySQL: Connection is busy with an unbuffered result, which has to be "
+        "read or destroyed first (" +
+        std::string(what) + ")");
+  }
+}
+
 inline auto assert_field(char* data) -> void {
   if (data == nullptr)
     throw std::logic_error("Trying to obtain NULL for non-nullable value");
@@ -124,7 +152,11 @@ class direct_execution_result_t {
 
 template <typename... ColumnSpecs>
 class direct_execution_result_t<result_row_t<ColumnSpecs...>> {
+  // Released after the handle, which fetches the remaining rows, if any
+  detail::connection_busy_token _busy;
   detail::unique_result_ptr _handle;
+  // Set for unbuffered results, which report errors via the connection
+  MYSQL* _connection = nullptr;
   MYSQL_ROW _data = nullptr;
   unsigned long* _lengths = nullptr;
   result_row_t<ColumnSpecs...> _row;
@@ -135,11 +167,26 @@ class direct_execution_result_t<result_row_t<ColumnSpecs...>> {
   direct_execution_result_t() = default;
   direct_execution_result_t(detail::unique_result_ptr handle)
       : _handle(std::move(handle)) {}
+  direct_execution_result_t(detail::unique_result_ptr handle,
+                            MYSQL* connection,
+                            detail::connection_busy_token busy)
+      : _busy(std::move(busy)),
+        _handle(std::move(handle)),
+        _connection(connection) {}
   direct_execution_result_t(const direct_execution_result_t&) = delete;
   direct_execution_result_t(direct_execution_result_t&& rhs) = default;
   direct_execution_result_t& operator=(const direct_execution_result_t&) =
       delete;
-  direct_execution_result_t& operator=(direct_execution_result_t&&) = default;
+  direct_execution_result_t& operator=(direct_execution_result_t&& rhs) noexcept {
+    // The result is freed before the connection that the token might own
+    _handle = std::move(rhs._handle);
+    _busy = std::move(rhs._busy);
+    _connection = std::exchange(rhs._connection, nullptr);
+    _data = std::exchange(rhs._data, nullptr);
+    _lengths = std::exchange(rhs._lengths, nullptr);
+    _row = std::move(rhs._row);
+    return *this;
+  }
   ~direct_execution_result_t() = default;
 
   [[nodiscard]] operator bool() const { return !!_handle; }
@@ -150,6 +197,10 @@ class direct_execution_result_t<result_row_t<ColumnSpecs...>> {
 
     if (_data != nullptr) {
       read_fields(_data, _lengths, _row);
+    } else if (_connection and mysql_errno(_connection)) {
+      const auto error = std::string(mysql_error(_connection));
+      reset();
+      throw sqlpp::exception("MySQL: Could not fetch next row: " + error);
     } else {
       reset();
     }
@@ -27,17 +27,25 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/exception.h>
+#include <sqlpp20/mysql/batch_parameters.h>
+#include <sqlpp20/mysql/direct_execution_result.h>
 #include <sqlpp20/mysql/mysql.h>
 #include <sqlpp20/mysql/prepared_statement_result.h>
 #include <sqlpp20/prepared_statement_parameters.h>
 #include <sqlpp20/result.h>
 #include <sqlpp20/result_row.h>
+#include <sqlpp20/sql_string_cache.h>
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
+#include <ranges>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace sqlpp::mysql::detail {
 struct prepared_statement_cleanup_t {
@@ -51,168 +59,230 @@ struct prepared_statement_cleanup_t {
 using unique_prepared_statement_ptr =
     std::unique_ptr<MYSQL_STMT, detail::prepared_statement_cleanup_t>;
 
+// Executes the round trips of a batch in a single transaction, which is rolled
+// back if it is not committed. Joins the caller's transaction instead, if
+// there is one, and the implicit one of sessions without autocommit.
+class batch_transaction_t {
+  MYSQL* _connection = nullptr;
+  bool _active = false;
+
+  auto execute_query(const std::string& query) -> void {
+    if (mysql_real_query(_connection, query.c_str(), query.size())) {
+      throw sqlpp::exception("MySQL: Could not execute query: " +
+                             std::string(mysql_error(_connection)) +
+                             " (query was >>" + query + "<<\n");
+    }
+  }
+
+ public:
+  explicit batch_transaction_t(MYSQL* connection) : _connection(connection) {}
+  batch_transaction_t(const batch_transaction_t&) = delete;
+  batch_transaction_t& operator=(const batch_transaction_t&) = delete;
+  ~batch_transaction_t() {
+    if (_active) {
+      mysql_real_query(_connection, "ROLLBACK", 8);
+    }
+  }
+
+  auto start() -> void {
+    const auto status = _connection->server_status;
+    if (_active or (status & SERVER_STATUS_IN_TRANS) or
+        not(status & SERVER_STATUS_AUTOCOMMIT)) {
+      return;
+    }
+    execute_query("START TRANSACTION");
+    _active = true;
+  }
+
+  auto commit() -> void {
+    if (_active) {
+      _active = false;
+      execute_query("COMMIT");
+    }
+  }
+};
 }  // namespace sqlpp::mysql::detail
 
-namespace sqlpp::mysql {
-inline auto bind_parameter(bind_meta_data_t& meta_data, MYSQL_BIND& parameter,
-                           const std::nullopt_t& value) -> void {
-  meta_data.is_null = true;
+namespace sqlpp::mysql::detail {
+// Parameters are bound once: MySQL reads values, lengths and NULL indicators
+// through the bound pointers at execution time. Returns true, if the binding
+// itself changed (e.g. a reallocated string), which requires binding again.
+inline auto update_parameter(bind_meta_data_t& meta_data, MYSQL_BIND& parameter,
+                             enum_field_types type, void* buffer,
+                             unsigned long length, bool is_null) -> bool {
+  meta_data.is_null = is_null;
+  meta_data.length = length;
+  if (parameter.buffer == buffer and parameter.buffer_type == type) {
+    return false;
+  }
 
   parameter.is_null = &meta_data.is_null;
-  parameter.buffer_type = MYSQL_TYPE_NULL;
-  parameter.buffer = nullptr;
-  parameter.buffer_length = 0;
-  parameter.length = &parameter.buffer_length;
+  parameter.buffer_type = type;
+  parameter.buffer = buffer;
+  parameter.buffer_length = length;
+  parameter.length = &meta_data.length;
   parameter.is_unsigned = false;
   parameter.error = nullptr;
+  return true;
+}
+}  // namespace sqlpp::mysql::detail
+
+namespace sqlpp::mysql {
+inline auto bind_parameter(bind_meta_data_t& meta_data, MYSQL_BIND& parameter,
+                           const std::nullopt_t& value) -> bool {
+  return detail::update_parameter(meta_data, parameter, MYSQL_TYPE_NULL,
+                                  nullptr, 0, true);
 }
 
 // Taking parameters by non-const reference to prevent temporaries being created
 // which would lead to dangling pointers in the implementation
 inline auto bind_parameter(bind_meta_data_t& meta_data, MYSQL_BIND& parameter,
-                           bool& value) -> void {
-  meta_data.is_null = false;
-
-  parameter.is_null = &meta_data.is_null;
-  parameter.buffer_type = MYSQL_TYPE_TINY;
-  parameter.buffer = &value;
-  parameter.buffer_length = sizeof(value);
-  parameter.length = &parameter.buffer_length;
-  parameter.is_unsigned = false;
-  parameter.error = nullptr;
+                           bool& value) -> bool {
+  return detail::update_parameter(meta_data, parameter, MYSQL_TYPE_TINY,
+                                  &value, sizeof(value), false);
 }
 
 inline auto bind_parameter(bind_meta_data_t& meta_data, MYSQL_BIND& parameter,
-                           std::int32_t& value) -> void {
-  meta_data.is_null = false;
-
-  parameter.is_null = &meta_data.is_null;
-  parameter.buffer_type = MYSQL_TYPE_LONG;
-  parameter.buffer = &value;
-  parameter.buffer_length = sizeof(value);
-  parameter.length = &parameter.buffer_length;
-  parameter.is_unsigned = false;
-  parameter.error = nullptr;
+                           std::int32_t& value) -> bool {
+  return detail::update_parameter(meta_data, parameter, MYSQL_TYPE_LONG,
+                                  &value, sizeof(value), false);
 }
 
 inline auto bind_parameter(bind_meta_data_t& meta_data, MYSQL_BIND& parameter,
-                           std::int64_t& value) -> void {
-  meta_data.is_null = false;
-
-  parameter.is_null = &meta_data.is_null;
-  parameter.buffer_type = MYSQL_TYPE_LONGLONG;
-  parameter.buffer = &value;
-  parameter.buffer_length = sizeof(value);
-  parameter.length = &parameter.buffer_length;
-  parameter.is_unsigned = false;
-  parameter.error = nullptr;
+                           std::int64_t& value) -> bool {
+  return detail::update_parameter(meta_data, parameter, MYSQL_TYPE_LONGLONG,
+                                  &value, sizeof(value), false);
 }
 
 inline auto bind_parameter(bind_meta_data_t& meta_data, MYSQL_BIND& parameter,
-                           float& value) -> void {
-  meta_data.is_null = false;
-
-  parameter.is_null = &meta_data.is_null;
-  parameter.buffer_type = MYSQL_TYPE_FLOAT;
-  parameter.buffer = &value;
-  parameter.buffer_length = sizeof(value);
-  parameter.length = &parameter.buffer_length;
-  parameter.is_unsigned = false;
-  parameter.error = nullptr;
+                           float& value) -> bool {
+  return detail::update_parameter(meta_data, parameter, MYSQL_TYPE_FLOAT,
+                                  &value, sizeof(value), false);
 }
 
 inline auto bind_parameter(bind_meta_data_t& meta_data, MYSQL_BIND& parameter,
-                           double& value) -> void {
-  meta_data.is_null = false;
-
-  parameter.is_null = &meta_data.is_null;
-  parameter.buffer_type = MYSQL_TYPE_DOUBLE;
-  parameter.buffer = &value;
-  parameter.buffer_length = sizeof(value);
-  parameter.length = &parameter.buffer_length;
-  parameter.is_unsigned = false;
-  parameter.error = nullptr;
+                           double& value) -> bool {
+  return detail::update_parameter(meta_data, parameter, MYSQL_TYPE_DOUBLE,
+                                  &value, sizeof(value), false);
 }
 
 inline auto bind_parameter(bind_meta_data_t& meta_data, MYSQL_BIND& parameter,
-                           std::string& value) -> void {
-  meta_data.is_null = false;
-
-  parameter.is_null = &meta_data.is_null;
-  parameter.buffer_type = MYSQL_TYPE_STRING;
-  parameter.buffer = value.data();
-  parameter.buffer_length = value.size();
-  parameter.length = &parameter.buffer_length;
-  parameter.is_unsigned = false;
-  parameter.error = nullptr;
+                           std::string& value) -> bool {
+  // Assigning values that fit the capacity keeps the string's buffer
+  return detail::update_parameter(meta_data, parameter, MYSQL_TYPE_STRING,
+                                  value.data(), value.size(), false);
 }
 
 inline auto bind_parameter(bind_meta_data_t& meta_data, MYSQL_BIND& parameter,
-                           std::string_view& value) -> void {
-  meta_data.is_null = false;
-
-  parameter.is_null = &meta_data.is_null;
-  parameter.buffer_type = MYSQL_TYPE_STRING;
-  parameter.buffer = const_cast<char*>(value.data());  // Sigh...
-  parameter.buffer_length = value.size();
-  parameter.length = &parameter.buffer_length;
-  parameter.is_unsigned = false;
-  parameter.error = nullptr;
+                           std::string_view& value) -> bool {
+  return detail::update_parameter(
+      meta_data, parameter, MYSQL_TYPE_STRING,
+      const_cast<char*>(value.data()),  // Sigh...
+      value.size(), false);
 }
 
 template <typename T>
 auto bind_parameter(bind_meta_data_t& meta_data, MYSQL_BIND& parameter,
-                    std::optional<T>& value) -> void {
-  value ? bind_parameter(meta_data, parameter, *value)
-        : bind_parameter(meta_data, parameter, std::nullopt);
+                    std::optional<T>& value) -> bool {
+  if (value) {
+    return bind_parameter(meta_data, parameter, *value);
+  }
+  // The NULL indicator suffices, if there is a binding already
+  if (parameter.buffer) {
+    meta_data.is_null = true;
+    return false;
+  }
+  return bind_parameter(meta_data, parameter, std::nullopt);
 }
 
 template <typename... ParameterSpecs>
 auto bind_parameters(
-    std::array<bind_meta_data_t, sizeof...(ParameterSpecs)>& meta_data,
-    std::array<MYSQL_BIND, sizeof...(ParameterSpecs)>& bind_data,
+    bind_meta_data_t* meta_data, MYSQL_BIND* bind_data,
     ::sqlpp::prepared_statement_parameters<type_vector<ParameterSpecs...>>&
-        parameters) -> void {
+        parameters) -> bool {
+  auto changed = false;
   int index = 0;
-  (..., (bind_parameter(
+  (..., (changed |= bind_parameter(
              meta_data[index], bind_data[index],
              static_cast<parameter_base_t<ParameterSpecs>&>(parameters)()),
          ++index));
+  return changed;
+}
+
+template <typename... ParameterSpecs>
+auto bind_parameters(
+    std::array<bind_meta_data_t, sizeof...(ParameterSpecs)>& meta_data,
+    std::array<MYSQL_BIND, sizeof...(ParameterSpecs)>& bind_data,
+    ::sqlpp::prepared_statement_parameters<type_vector<ParameterSpecs...>>&
+        parameters) -> bool {
+  return bind_parameters(meta_data.data(), bind_data.data(), parameters);
 }
 
 template <typename ResultType, typename ParameterVector, typename ResultRow>
 class prepared_statement_t {
   detail::unique_prepared_statement_ptr _handle;
-#warning : This should be a tuple of correct types
   std::array<bind_meta_data_t, ParameterVector::size()>
       _parameter_bind_meta_data = {};
   std::array<MYSQL_BIND, ParameterVector::size()> _parameter_bind_data = {};
+  // The bindings point into this object, moving it invalidates them
+  const void* _parameters_bound_to = nullptr;
+  bool _use_cursor = false;
+  MYSQL* _connection = nullptr;
+  detail::connection_busy_state_ptr _busy;
+  // Inserts keep their SQL text and the values of their row for multi-row
+  // batches
+  std::string _sql;
+  std::string _values_row;
 
  public:
   ::sqlpp::prepared_statement_parameters<ParameterVector> parameters = {};
 
   prepared_statement_t() = default;
-  template <typename Connection, typename Statement>
+  template <typename Connection>
   prepared_statement_t(const Connection& connection,
-                       const Statement& statement) {
+                       const std::string_view& sql_string) {
     detail::thread_init();
-    const auto sql_string = to_sql_string_c(context_t{}, statement);
+
+    detail::check_not_busy(connection._busy, "statement was >>" +
+                                                 std::string(sql_string) +
+                                                 "<<");
 
     if constexpr (Connection::is_debug_allowed())
-      connection.debug("Preparing: '" + sql_string + "'");
+      connection.debug("Preparing: '" + std::string(sql_string) + "'");
 
-    _handle = detail::unique_prepared_statement_ptr(
-        mysql_stmt_init(connection.get()), {});
-    if (not _handle) {
-      throw sqlpp::exception("MySQL: Could not allocate prepared statement\n");
+    _connection = connection.get();
+    _busy = connection._busy;
+    _handle = prepare(sql_string);
+    if constexpr (std::is_same_v<ResultType, insert_result>) {
+      _sql = sql_string;
     }
-    if (mysql_stmt_prepare(_handle.get(), sql_string.data(),
-                           sql_string.size())) {
-      throw sqlpp::exception("MySQL: Could not prepare statement: " +
-                             std::string(mysql_error(connection.get())) +
-                             " (statement was >>" + sql_string + "<<\n");
+    if constexpr (std::is_same_v<ResultType, select_result>) {
+      // Stored results report the longest value per column, for sizing
+      // result buffers
+      const my_bool update_max_length = true;
+      mysql_stmt_attr_set(_handle.get(), STMT_ATTR_UPDATE_MAX_LENGTH,
+                          &update_max_length);
+    }
+  }
+
+  template <typename Connection, typename Statement>
+  prepared_statement_t(const Connection& connection, const Statement& statement)
+      : prepared_statement_t{
+            connection,
+            std::string_view{to_sql_string_cached(
+                detail::make_context(connection.get()), statement)}} {
+    if constexpr (requires(context_t& context) {
+                    detail::values_row<ParameterVector>(context, statement);
+                  }) {
+      auto context = detail::make_context(connection.get());
+      _values_row = detail::values_row<ParameterVector>(context, statement);
+      // The values have to end the statement to be repeated
+      if (not _sql.ends_with(_values_row)) {
+        _values_row.clear();
+      }
     }
   }
+
   prepared_statement_t(const prepared_statement_t&) = delete;
   prepared_statement_t(prepared_statement_t&& rhs) = default;
   prepared_statement_t& operator=(const prepared_statement_t&) = delete;
@@ -221,14 +291,22 @@ class prepared_statement_t {
 
   auto execute() {
     detail::thread_init();
+    detail::check_not_busy(_busy, "executing a prepared statement");
 
-    ::sqlpp::mysql::bind_parameters(_parameter_bind_meta_data,
-                                    _parameter_bind_data, parameters);
-
-    if (mysql_stmt_bind_param(_handle.get(), _parameter_bind_data.data())) {
-      throw sqlpp::exception(
-          std::string("MySQL: Could not bind parameters to statement") +
-          mysql_stmt_error(_handle.get()));
+    const auto moved = _parameters_bound_to != this;
+    if (moved) {
+      _parameter_bind_data = {};
+    }
+    if (::sqlpp::mysql::bind_parameters(_parameter_bind_meta_data,
+                                        _parameter_bind_data, parameters) or
+        moved) {
+      if (mysql_stmt_bind_param(_handle.get(), _parameter_bind_data.data())) {
+        _parameters_bound_to = nullptr;
+        throw sqlpp::exception(
+            std::string("MySQL: Could not bind parameters to statement: ") +
+            mysql_stmt_error(_handle.get()));
+      }
+      _parameters_bound_to = this;
     }
 
     if (mysql_stmt_execute(_handle.get())) {
@@ -244,7 +322,13 @@ class prepared_statement_t {
     } else if constexpr (std::is_same_v<ResultType, update_result>) {
       return mysql_stmt_affected_rows(this->get());
     } else if constexpr (std::is_same_v<ResultType, select_result>) {
-      mysql_stmt_store_result(this->get());
+      // Rows of cursors stay on the server until they are fetched
+      if (not _use_cursor and mysql_stmt_store_result(this->get())) {
+        throw sqlpp::exception(
+            std::string("MySQL: Could not store result of prepared "
+                        "statement: ") +
+            mysql_stmt_error(this->get()));
+      }
 
       return ::sqlpp::result_t<prepared_statement_result_t<ResultRow>>{
           {detail::unique_prepared_result_ptr{_handle.get(), {}},
@@ -256,7 +340,214 @@ class prepared_statement_t {
     }
   }
 
+  // Executes the statement once per element of `parameter_sets` (each a
+  // parameters object of this statement) and returns the number of affected
+  // rows. Up to `batch_size` sets are sent to the server at once:
+  // - with MariaDB, as arrays of parameter values (bulk execution),
+  // - otherwise, inserts become multi-row inserts,
+  // - other statements are executed set by set, leaving the last set in
+  //   `parameters`.
+  // Several round trips are executed in a single transaction, unless there is
+  // an active transaction already.
+  template <std::ranges::forward_range Range>
+  auto execute_batch(const Range& parameter_sets, std::size_t batch_size = 1000)
+      -> std::uint64_t requires(not std::is_same_v<ResultType, select_result>) {
+    static_assert(
+        std::is_lvalue_reference_v<std::ranges::range_reference_t<const Range>>,
+        "Parameter sets are bound by address and must not be temporaries");
+    detail::thread_init();
+    detail::check_not_busy(_busy, "executing a batch of a prepared statement");
+
+    batch_size = std::max(batch_size, std::size_t{1});
+    if constexpr (ParameterVector::size() > 0) {
+#ifdef SQLPP_MYSQL_ARRAY_BINDING
+      if (detail::supports_array_binding(_connection)) {
+        return execute_array_batch(parameter_sets, batch_size);
+      }
+#endif
+      if (not _values_row.empty()) {
+        return execute_multi_row_batch(parameter_sets, batch_size);
+      }
+    }
+
+    auto transaction = detail::batch_transaction_t{_connection};
+    auto affected_rows = std::uint64_t{0};
+    auto it = std::ranges::begin(parameter_sets);
+    const auto end = std::ranges::end(parameter_sets);
+    while (it != end) {
+      parameters = *it;
+      if (++it != end) {
+        transaction.start();
+      }
+      execute();
+      affected_rows += mysql_stmt_affected_rows(_handle.get());
+    }
+    transaction.commit();
+    return affected_rows;
+  }
+
+  // Reads the rows of subsequent executions through a read-only server side
+  // cursor, `prefetch_rows` rows per round trip, instead of storing the whole
+  // result on the client first. Other statements can be executed on the
+  // connection while the cursor is open. Zero switches back to storing
+  // results.
+  auto use_cursor(unsigned long prefetch_rows = 1) -> void
+      requires(std::is_same_v<ResultType, select_result>) {
+    const auto cursor_type =
+        static_cast<unsigned long>(prefetch_rows ? CURSOR_TYPE_READ_ONLY
+                                                 : CURSOR_TYPE_NO_CURSOR);
+    if (mysql_stmt_attr_set(_handle.get(), STMT_ATTR_CURSOR_TYPE,
+                            &cursor_type) or
+        (prefetch_rows and mysql_stmt_attr_set(_handle.get(),
+                                               STMT_ATTR_PREFETCH_ROWS,
+                                               &prefetch_rows))) {
+      throw sqlpp::exception(
+          std::string("MySQL: Could not set cursor attributes: ") +
+          mysql_stmt_error(_handle.get()));
+    }
+    _use_cursor = prefetch_rows != 0;
+  }
+
   auto get() const -> MYSQL_STMT* { return _handle.get(); }
+
+ private:
+  auto prepare(const std::string_view& sql_string) const
+      -> detail::unique_prepared_statement_ptr {
+    auto handle =
+        detail::unique_prepared_statement_ptr(mysql_stmt_init(_connection), {});
+    if (not handle) {
+      throw sqlpp::exception("MySQL: Could not allocate prepared statement\n");
+    }
+    if (mysql_stmt_prepare(handle.get(), sql_string.data(),
+                           sql_string.size())) {
+      throw sqlpp::exception("MySQL: Could not prepare statement: " +
+                             std::string(mysql_error(_connection)) +
+                             " (statement was >>" + std::string(sql_string) +
+                             "<<\n");
+    }
+    return handle;
+  }
+
+#ifdef SQLPP_MYSQL_ARRAY_BINDING
+  template <typename Range>
+  auto execute_array_batch(const Range& parameter_sets, std::size_t batch_size)
+      -> std::uint64_t {
+    auto arrays = detail::array_parameters_t<ParameterVector>{};
+    auto bind_data = std::array<MYSQL_BIND, ParameterVector::size()>{};
+    auto affected_rows = std::uint64_t{0};
+    auto array_size = 0u;
+
+    // Regular executions bind their parameters again
+    _parameters_bound_to = nullptr;
+    const auto finish = [&](const char* error) {
+      array_size = 0;
+      mysql_stmt_attr_set(_handle.get(), STMT_ATTR_ARRAY_SIZE, &array_size);
+      if (error) {
+        throw sqlpp::exception(std::string(error) +
+                               mysql_stmt_error(_handle.get()));
+      }
+    };
+
+    auto transaction = detail::batch_transaction_t{_connection};
+    auto it = std::ranges::begin(parameter_sets);
+    const auto end = std::ranges::end(parameter_sets);
+    while (it != end) {
+      arrays.clear();
+      for (; it != end and arrays.size() < batch_size; ++it) {
+        arrays.add(*it);
+      }
+      if (it != end) {
+        transaction.start();
+      }
+      arrays.bind(bind_data);
+      array_size = static_cast<unsigned int>(arrays.size());
+      if (mysql_stmt_attr_set(_handle.get(), STMT_ATTR_ARRAY_SIZE,
+                              &array_size) or
+          mysql_stmt_bind_param(_handle.get(), bind_data.data())) {
+        finish("MySQL: Could not bind parameter arrays to statement: ");
+      }
+      if (mysql_stmt_execute(_handle.get())) {
+        finish("MySQL: Could not execute prepared statement batch: ");
+      }
+      affected_rows += mysql_stmt_affected_rows(_handle.get());
+    }
+    finish(nullptr);
+    transaction.commit();
+    return affected_rows;
+  }
+#endif
+
+  template <typename Range>
+  auto execute_multi_row_batch(const Range& parameter_sets,
+                               std::size_t batch_size) -> std::uint64_t {
+    constexpr auto parameter_count = ParameterVector::size();
+    // MySQL accepts at most 65535 placeholders per statement
+    const auto max_rows =
+        std::min(batch_size, std::size_t{65535} / parameter_count);
+
+    const auto multi_row_sql = [&](std::size_t rows) {
+      auto sql = _sql;
+      sql.reserve(_sql.size() + (rows - 1) * (_values_row.size() + 2));
+      for (auto row = std::size_t{1}; row < rows; ++row) {
+        sql.append(", ").append(_values_row);
+      }
+      return sql;
+    };
+
+    // Bindings point directly into the parameter sets, which MySQL only reads
+    auto meta_data = std::vector<bind_meta_data_t>(max_rows * parameter_count);
+    auto bind_data = std::vector<MYSQL_BIND>(max_rows * parameter_count);
+    const auto execute_rows = [&](MYSQL_STMT* handle, auto first,
+                                  std::size_t rows) {
+      std::fill(bind_data.begin(), bind_data.end(), MYSQL_BIND{});
+      for (auto row = std::size_t{0}; row < rows; ++row, ++first) {
+        ::sqlpp::mysql::bind_parameters(
+            meta_data.data() + row * parameter_count,
+            bind_data.data() + row * parameter_count,
+            const_cast<::sqlpp::prepared_statement_parameters<ParameterVector>&>(
+                static_cast<const ::sqlpp::prepared_statement_parameters<
+                    ParameterVector>&>(*first)));
+      }
+      if (mysql_stmt_bind_param(handle, bind_data.data())) {
+        throw sqlpp::exception(
+            std::string("MySQL: Could not bind parameters to statement: ") +
+            mysql_stmt_error(handle));
+      }
+      if (mysql_stmt_execute(handle)) {
+        throw sqlpp::exception(
+            std::string("MySQL: Could not execute multi-row insert: ") +
+            mysql_stmt_error(handle));
+      }
+      return mysql_stmt_affected_rows(handle);
+    };
+
+    auto transaction = detail::batch_transaction_t{_connection};
+    auto affected_rows = std::uint64_t{0};
+    auto chunk_handle = detail::unique_prepared_statement_ptr{};
+    auto it = std::ranges::begin(parameter_sets);
+    const auto end = std::ranges::end(parameter_sets);
+    while (it != end) {
+      const auto first = it;
+      auto rows = std::size_t{0};
+      for (; it != end and rows < max_rows; ++it) {
+        ++rows;
+      }
+      if (it != end) {
+        transaction.start();
+      }
+      if (rows == max_rows) {
+        if (not chunk_handle) {
+          chunk_handle = prepare(multi_row_sql(max_rows));
+        }
+        affected_rows += execute_rows(chunk_handle.get(), first, rows);
+      } else {
+        auto handle = prepare(multi_row_sql(rows));
+        affected_rows += execute_rows(handle.get(), first, rows);
+      }
+    }
+    transaction.commit();
+    return affected_rows;
+  }
 };
 
 template <typename Connection, typename Statement>
@@ -28,11 +28,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <sqlpp20/exception.h>
 #include <sqlpp20/mysql/bind_meta_data.h>
+#include <sqlpp20/mysql/direct_execution_result.h>
 #include <sqlpp20/result_row.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
 
 namespace sqlpp::mysql::detail {
@@ -54,6 +58,44 @@ auto bind(MYSQL_STMT* stmt, BindParameters& bind_parameters) -> void {
                            mysql_stmt_error(stmt));
   }
 }
+
+// Columns with larger (or unknown) maximum lengths start with buffers of this
+// size and grow on demand
+inline constexpr auto max_initial_field_buffer_size = std::size_t{4096};
+
+// Stored results know the length of their longest value per column (see
+// STMT_ATTR_UPDATE_MAX_LENGTH), cursors only the length of the column type
+inline auto initial_field_buffer_size(const MYSQL_FIELD& field)
+    -> std::size_t {
+  return field.max_length
+             ? static_cast<std::size_t>(field.max_length)
+             : std::min(static_cast<std::size_t>(field.length),
+                        max_initial_field_buffer_size);
+}
+
+template <typename Buffer>
+auto size_field_buffer([[maybe_unused]] Buffer& buffer,
+                       [[maybe_unused]] const MYSQL_FIELD& field) -> void {}
+
+inline auto size_field_buffer(std::string& buffer, const MYSQL_FIELD& field)
+    -> void {
+  buffer.resize(initial_field_buffer_size(field));
+}
+
+// Sizes string buffers up front, so that typical values are fetched without
+// truncation
+template <typename... Buffers, unsigned... Is>
+auto size_field_buffers(MYSQL_STMT* stmt, std::tuple<Buffers...>& buffers,
+                        std::integer_sequence<unsigned, Is...>) -> void {
+  const auto meta_data =
+      unique_result_ptr(mysql_stmt_result_metadata(stmt), {});
+  if (not meta_data or
+      mysql_num_fields(meta_data.get()) != sizeof...(Buffers)) {
+    return;
+  }
+  const auto* fields = mysql_fetch_fields(meta_data.get());
+  (..., size_field_buffer(std::get<Is>(buffers), fields[Is]));
+}
 }  // namespace sqlpp::mysql::detail
 
 namespace sqlpp::mysql {
@@ -76,12 +118,14 @@ template <typename ColumnSpec>
 using buffer_type_of_t =
     typename value_type_buffer<value_type_of_t<ColumnSpec>>::type;
 
-auto refetch_truncated_field(MYSQL_STMT* stmt,
-                             [[maybe_unused]] std::string_view& field,
-                             std::string& buffer, bind_meta_data_t& meta_data,
-                             MYSQL_BIND& param, unsigned index) -> void {
+// Returns true, if the buffer had to grow (and therefore has to be bound again)
+inline auto refetch_truncated_field(MYSQL_STMT* stmt,
+                                    [[maybe_unused]] std::string_view& field,
+                                    std::string& buffer,
+                                    bind_meta_data_t& meta_data,
+                                    MYSQL_BIND& param, unsigned index) -> bool {
   if (meta_data.length > buffer.size()) {
-    buffer.resize(meta_data.length);
+    buffer.resize(std::max<std::size_t>(meta_data.length, 2 * buffer.size()));
     param.buffer = buffer.data();
     param.buffer_length = buffer.size();
 
@@ -93,21 +137,28 @@ auto refetch_truncated_field(MYSQL_STMT* stmt,
           ", stmt-error: " + mysql_stmt_error(stmt) +
           ", stmt-errno: " + std::to_string(mysql_stmt_errno(stmt)) +
           ", field index: " + std::to_string(index));
+    return true;
   }
+  return false;
 }
 
 template <typename Field>
 auto refetch_truncated_field(MYSQL_STMT* stmt, [[maybe_unused]] Field& field,
                              [[maybe_unused]] Field& buffer,
                              bind_meta_data_t& meta_data, MYSQL_BIND& param,
-                             unsigned index) -> void {}
+                             unsigned index) -> bool {
+  return false;
+}
 
 template <typename Field, typename Buffer>
 auto refetch_truncated_field(MYSQL_STMT* stmt,
                              [[maybe_unused]] std::optional<Field>& field,
                              Buffer& buffer, bind_meta_data_t& meta_data,
-                             MYSQL_BIND& param, unsigned index) -> void {
-  refetch_truncated_field(stmt, buffer, buffer, meta_data, param, index);
+                             MYSQL_BIND& param, unsigned index) -> bool {
+  if (meta_data.is_null) return false;
+  auto buffer_field = Field{};
+  return refetch_truncated_field(stmt, buffer_field, buffer, meta_data, param,
+                                 index);
 }
 
 template <typename... ColumnSpecs, unsigned... Is>
@@ -116,10 +167,12 @@ auto refetch_truncated_fields(
     std::tuple<buffer_type_of_t<ColumnSpecs>...>& buffers,
     std::array<bind_meta_data_t, sizeof...(ColumnSpecs)>& meta_data,
     std::array<MYSQL_BIND, sizeof...(ColumnSpecs)>& bind_parameters,
-    std::integer_sequence<unsigned, Is...>) -> void {
-  (..., refetch_truncated_field(
-            stmt, static_cast<result_column_base<ColumnSpecs>&>(row)(),
-            std::get<Is>(buffers), meta_data[Is], bind_parameters[Is], Is));
+    std::integer_sequence<unsigned, Is...>) -> bool {
+  auto grown = false;
+  (..., (grown |= refetch_truncated_field(
+             stmt, static_cast<result_column_base<ColumnSpecs>&>(row)(),
+             std::get<Is>(buffers), meta_data[Is], bind_parameters[Is], Is)));
+  return grown;
 }
 
 template <typename... ColumnSpecs>
@@ -132,11 +185,14 @@ auto get_next_result_row(
 
   switch (flag) {
     case 0:
+      return true;
     case MYSQL_DATA_TRUNCATED:
-      refetch_truncated_fields(
-          stmt, row, buffers, meta_data, bind_parameters,
-          std::make_integer_sequence<unsigned, sizeof...(ColumnSpecs)>{});
-      ::sqlpp::mysql::detail::bind(stmt, bind_parameters);
+      // Grown buffers are bound for the following rows
+      if (refetch_truncated_fields(
+              stmt, row, buffers, meta_data, bind_parameters,
+              std::make_integer_sequence<unsigned, sizeof...(ColumnSpecs)>{})) {
+        ::sqlpp::mysql::detail::bind(stmt, bind_parameters);
+      }
       return true;
     case 1:
       throw sqlpp::exception(
@@ -261,6 +317,9 @@ auto assign_field(std::optional<Field>& field, const Buffer& buffer,
                   const bind_meta_data_t& meta_data) -> void {
   if (meta_data.is_null) {
     field.reset();
+  } else if constexpr (std::is_same_v<Field, std::string_view>) {
+    // The buffer is usually larger than the value
+    field = std::string_view{buffer.data(), meta_data.length};
   } else {
     field = buffer;
   }
@@ -310,6 +369,9 @@ class prepared_statement_result_t<result_row_t<ColumnSpecs...>> {
 
   auto get_next_row() -> void {
     if (_unbound) {
+      detail::size_field_buffers(
+          _handle.get(), _bind_buffers,
+          std::make_integer_sequence<unsigned, sizeof...(ColumnSpecs)>{});
       prepare_field_parameters(
           _row, _bind_buffers, _bind_meta_data, _bind_parameters,
           std::make_integer_sequence<unsigned, sizeof...(ColumnSpecs)>{});
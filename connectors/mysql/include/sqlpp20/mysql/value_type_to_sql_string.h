@@ -26,6 +26,7 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/data_types.h>
 #include <sqlpp20/value_type_to_sql_string.h>
 
 #include <string>
@@ -72,4 +73,9 @@ template <uint8_t Size>
   return " VARCHAR(" + std::to_string(Size) + ")";
 }
 
+[[nodiscard]] inline auto value_type_to_sql_string(::sqlpp::mysql::context_t&,
+                                                   type_t<::sqlpp::text>) {
+  return " TEXT";
+}
+
 }  // namespace sqlpp
@@ -0,0 +1,201 @@
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/clause/update.h>
+#include <sqlpp20/mysql_test/get_config.h>
+#include <sqlpp20/parameter.h>
+#include <sqlpp20/transaction.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+using test::tabPerson;
+
+SQLPP_CREATE_NAME_TAG(pId);
+SQLPP_CREATE_NAME_TAG(pName);
+SQLPP_CREATE_NAME_TAG(pIsManager);
+SQLPP_CREATE_NAME_TAG(pAddress);
+
+using ::sqlpp::test::expect;
+using ::sqlpp::test::expect_exception;
+
+struct person {
+  bool is_manager;
+  std::string name;
+  std::optional<std::string> address;
+
+  auto operator==(const person&) const -> bool = default;
+};
+}  // namespace
+
+namespace mysql = sqlpp::mysql;
+int main() {
+  try {
+    mysql::global_library_init();
+
+    const auto config = mysql::test::get_config();
+    auto db = mysql::connection_t<sqlpp::debug::none>{config};
+    db(drop_table(tabPerson));
+    db(create_table(tabPerson));
+
+    auto prepared_insert = db.prepare(insert_into(tabPerson).set(
+        tabPerson.isManager = ::sqlpp::parameter<bool>(pIsManager),
+        tabPerson.name = ::sqlpp::parameter<std::string>(pName),
+        tabPerson.address =
+            ::sqlpp::parameter<std::optional<std::string_view>>(pAddress)));
+
+    auto expected = std::vector<person>{};
+    auto parameter_sets = std::vector<decltype(prepared_insert.parameters)>{};
+    for (auto i = 0; i < 23; ++i) {
+      auto p = person{i % 3 == 0, std::string(i + 1, 'a' + i % 26), {}};
+      if (i % 4 != 1) {
+        p.address = "street " + std::to_string(i);
+      }
+      expected.push_back(p);
+    }
+    for (const auto& p : expected) {
+      auto& parameters = parameter_sets.emplace_back();
+      parameters.pIsManager = p.is_manager;
+      parameters.pName = p.name;
+      if (p.address) {
+        parameters.pAddress = std::string_view{*p.address};
+      }
+    }
+
+    // Full batches and a smaller remainder
+    expect(prepared_insert.execute_batch(parameter_sets, 10) ==
+               parameter_sets.size(),
+           "unexpected number of inserted rows");
+    expect(prepared_insert.execute_batch(std::vector<decltype(
+                   prepared_insert.parameters)>{}) == 0,
+           "unexpected number of rows for empty batch");
+
+    // Regular executions still work after a batch
+    prepared_insert.parameters = parameter_sets.front();
+    execute(prepared_insert);
+    expected.push_back(expected.front());
+
+    auto ids = std::vector<std::int64_t>{};
+    auto actual = std::vector<person>{};
+    for (const auto& row : db(select(tabPerson.id, tabPerson.isManager,
+                                     tabPerson.name, tabPerson.address)
+                                  .from(tabPerson)
+                                  .order_by(tabPerson.id.asc()))) {
+      ids.push_back(row.id);
+      actual.push_back(person{
+          row.isManager, std::string(row.name),
+          row.address ? std::optional<std::string>(*row.address)
+                      : std::nullopt});
+    }
+    expect(actual == expected, "unexpected persons after batch inserts");
+
+    // Statements other than inserts
+    auto prepared_update = db.prepare(
+        update(tabPerson)
+            .set(tabPerson.name = ::sqlpp::parameter<std::string>(pName))
+            .where(tabPerson.id == ::sqlpp::parameter<std::int64_t>(pId)));
+    auto update_sets = std::vector<decltype(prepared_update.parameters)>{};
+    for (auto i = std::size_t{0}; i < ids.size(); i += 2) {
+      auto& parameters = update_sets.emplace_back();
+      parameters.pId = ids[i];
+      parameters.pName = "updated";
+      expected[i].name = "updated";
+    }
+    expect(prepared_update.execute_batch(update_sets, 4) == update_sets.size(),
+           "unexpected number of updated rows");
+
+    actual.clear();
+    for (const auto& row :
+         db(select(tabPerson.isManager, tabPerson.name, tabPerson.address)
+                .from(tabPerson)
+                .order_by(tabPerson.id.asc()))) {
+      actual.push_back(person{
+          row.isManager, std::string(row.name),
+          row.address ? std::optional<std::string>(*row.address)
+                      : std::nullopt});
+    }
+    expect(actual == expected, "unexpected persons after batch updates");
+
+    const auto count_rows = [&db]() {
+      auto rows = std::size_t{0};
+      for (const auto& row : db(select(tabPerson.id).from(tabPerson))) {
+        static_cast<void>(row);
+        ++rows;
+      }
+      return rows;
+    };
+    const auto row_count = count_rows();
+
+    // Batches join a transaction opened by the caller
+    {
+      auto tx = start_transaction(db);
+      prepared_insert.execute_batch(parameter_sets, 10);
+      expect(db.is_transaction_active(), "transaction has been closed");
+      expect(count_rows() == row_count + parameter_sets.size(),
+             "unexpected row count in transaction");
+      tx.rollback();
+      expect(count_rows() == row_count, "rows have been kept after rollback");
+    }
+
+    // Round trips of a failing batch are rolled back
+    {
+      auto prepared_insert_with_id = db.prepare(insert_into(tabPerson).set(
+          tabPerson.id = ::sqlpp::parameter<std::int64_t>(pId),
+          tabPerson.isManager = false,
+          tabPerson.name = ::sqlpp::parameter<std::string>(pName),
+          tabPerson.address = std::nullopt));
+      auto id_sets =
+          std::vector<decltype(prepared_insert_with_id.parameters)>{};
+      for (auto i = 0; i < 12; ++i) {
+        auto& parameters = id_sets.emplace_back();
+        parameters.pId = ids.back() + 1 + i;
+        parameters.pName = "with id";
+      }
+      // The second round trip fails
+      id_sets.back().pId = ids.front();
+      expect_exception(
+          [&] { prepared_insert_with_id.execute_batch(id_sets, 10); },
+          "batch with duplicate id did not fail");
+      expect(count_rows() == row_count,
+             "rows of failed batch have been kept");
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
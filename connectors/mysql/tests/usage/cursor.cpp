@@ -0,0 +1,102 @@
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/mysql_test/get_config.h>
+#include <sqlpp20/parameter.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+using test::tabPerson;
+
+using ::sqlpp::test::expect;
+}  // namespace
+
+namespace mysql = sqlpp::mysql;
+int main() {
+  try {
+    mysql::global_library_init();
+
+    const auto config = mysql::test::get_config();
+    auto db = mysql::connection_t<sqlpp::debug::none>{config};
+    db(drop_table(tabPerson));
+    db(create_table(tabPerson));
+    for (auto i = 0; i < 100; ++i) {
+      db(insert_into(tabPerson).set(tabPerson.isManager = (i % 10 == 0),
+                                    tabPerson.name =
+                                        "person " + std::to_string(i)));
+    }
+
+    auto prepared_select =
+        db.prepare(select(tabPerson.id, tabPerson.name)
+                       .from(tabPerson)
+                       .where(tabPerson.isManager ==
+                              sqlpp::parameter<bool>(tabPerson.isManager)));
+    prepared_select.use_cursor(7);
+
+    // Rows arrive in batches, other statements can run in between
+    for (const auto manager : {false, true}) {
+      prepared_select.parameters.isManager = manager;
+      auto count = 0;
+      for (const auto& row : execute(prepared_select)) {
+        expect(row.name.starts_with("person "), "unexpected name");
+        if (++count == 1) {
+          db(insert_into(tabPerson).set(tabPerson.isManager = manager,
+                                        tabPerson.name = "latecomer"));
+        }
+      }
+      expect(count == (manager ? 10 : 90),
+             "unexpected number of rows read through cursor");
+    }
+
+    // Rows inserted while the cursor was open show up in the next execution
+    prepared_select.parameters.isManager = true;
+    auto count = 0;
+    for ([[maybe_unused]] const auto& row : execute(prepared_select)) {
+      ++count;
+    }
+    expect(count == 11, "unexpected number of rows read through cursor");
+
+    // Back to storing results
+    prepared_select.use_cursor(0);
+    count = 0;
+    for ([[maybe_unused]] const auto& row : execute(prepared_select)) {
+      ++count;
+    }
+    expect(count == 11, "unexpected number of stored rows");
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
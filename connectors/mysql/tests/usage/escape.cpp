@@ -0,0 +1,107 @@
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/mysql/connection.h>
+#include <sqlpp20/mysql_test/get_config.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+using test::tabPerson;
+
+using ::sqlpp::test::expect;
+
+// Inserts names with quotes and backslashes and reads them back
+template <typename Db>
+auto test_round_trip(Db& db) -> void {
+  db(drop_table(tabPerson));
+  db(create_table(tabPerson));
+  const auto names = {std::string{"O'Neil"}, std::string{"back\\slash"},
+                      std::string{"\\'"}, std::string{"trailing \\"}};
+  for (const auto& name : names) {
+    const auto id = db(insert_into(tabPerson).set(tabPerson.name = name,
+                                                  tabPerson.isManager = false));
+    auto found = 0;
+    for (const auto& row : db(select(tabPerson.name)
+                                  .from(tabPerson)
+                                  .where(tabPerson.id == id))) {
+      expect(row.name == name, "name changed in round trip");
+      ++found;
+    }
+    expect(found == 1, "name not found by id");
+
+    found = 0;
+    for ([[maybe_unused]] const auto& row :
+         db(select(tabPerson.id)
+                .from(tabPerson)
+                .where(tabPerson.name == name))) {
+      ++found;
+    }
+    expect(found == 1, "name not found by value");
+  }
+}
+}  // namespace
+
+namespace mysql = sqlpp::mysql;
+int main() {
+  try {
+    mysql::global_library_init();
+
+    auto config = mysql::test::get_config();
+    {
+      auto db = mysql::connection_t<sqlpp::debug::none>{config};
+      expect(not mysql::detail::make_context(db.get()).no_backslash_escapes,
+             "unexpected NO_BACKSLASH_ESCAPES by default");
+      test_round_trip(db);
+    }
+
+    config.post_connect = [](MYSQL* handle) {
+      if (mysql_query(handle,
+                      "SET SESSION sql_mode = "
+                      "CONCAT(@@sql_mode, ',NO_BACKSLASH_ESCAPES')")) {
+        throw std::runtime_error(mysql_error(handle));
+      }
+    };
+    {
+      auto db = mysql::connection_t<sqlpp::debug::none>{config};
+      expect(mysql::detail::make_context(db.get()).no_backslash_escapes,
+             "NO_BACKSLASH_ESCAPES not detected");
+      test_round_trip(db);
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
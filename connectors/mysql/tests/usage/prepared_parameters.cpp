@@ -0,0 +1,123 @@
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/mysql_test/get_config.h>
+#include <sqlpp20/parameter.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+using test::tabPerson;
+
+SQLPP_CREATE_NAME_TAG(pName);
+SQLPP_CREATE_NAME_TAG(pIsManager);
+SQLPP_CREATE_NAME_TAG(pAddress);
+
+using ::sqlpp::test::expect;
+
+struct person {
+  bool is_manager;
+  std::string name;
+  std::optional<std::string> address;
+
+  auto operator==(const person&) const -> bool = default;
+};
+}  // namespace
+
+namespace mysql = sqlpp::mysql;
+int main() {
+  try {
+    mysql::global_library_init();
+
+    const auto config = mysql::test::get_config();
+    auto db = mysql::connection_t<sqlpp::debug::none>{config};
+    db(drop_table(tabPerson));
+    db(create_table(tabPerson));
+
+    auto prepared_insert = db.prepare(insert_into(tabPerson).set(
+        tabPerson.isManager = ::sqlpp::parameter<bool>(pIsManager),
+        tabPerson.name = ::sqlpp::parameter<std::string>(pName),
+        tabPerson.address =
+            ::sqlpp::parameter<std::optional<std::string_view>>(pAddress)));
+
+    // Values change between executions: strings grow beyond their capacity,
+    // optional values switch between NULL and not NULL, string_views refer
+    // to different buffers
+    auto expected = std::vector<person>{};
+    for (auto i = 0; i < 50; ++i) {
+      auto p = person{i % 3 == 0, std::string(i * 5 + 1, 'a' + i % 26), {}};
+      if (i % 4 != 1) {
+        p.address = "street " + std::to_string(i);
+      }
+      expected.push_back(p);
+    }
+    for (const auto& p : expected) {
+      prepared_insert.parameters.pIsManager = p.is_manager;
+      prepared_insert.parameters.pName = p.name;
+      if (p.address) {
+        prepared_insert.parameters.pAddress = std::string_view{*p.address};
+      } else {
+        prepared_insert.parameters.pAddress.reset();
+      }
+      execute(prepared_insert);
+    }
+
+    // Moving the statement moves the bound values
+    auto moved_insert = std::move(prepared_insert);
+    moved_insert.parameters.pIsManager = true;
+    moved_insert.parameters.pName = "moved";
+    moved_insert.parameters.pAddress.reset();
+    execute(moved_insert);
+    expected.push_back(person{true, "moved", {}});
+
+    auto actual = std::vector<person>{};
+    for (const auto& row :
+         db(select(tabPerson.isManager, tabPerson.name, tabPerson.address)
+                .from(tabPerson)
+                .order_by(tabPerson.id.asc()))) {
+      actual.push_back(person{
+          row.isManager, std::string(row.name),
+          row.address ? std::optional<std::string>(*row.address)
+                      : std::nullopt});
+    }
+    expect(actual == expected, "unexpected persons after prepared inserts");
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,137 @@
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/data_types.h>
+#include <sqlpp20/mysql_test/get_config.h>
+#include <sqlpp20/name_tag.h>
+#include <sqlpp20/table.h>
+#include <sqlpp20_test/expect.h>
+
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+struct TabNote : public ::sqlpp::spec_base {
+  SQLPP_NAME_TAGS_FOR_SQL_AND_CPP(tab_note, tabNote);
+
+  struct Id : public ::sqlpp::spec_base {
+    SQLPP_NAME_TAGS_FOR_SQL_AND_CPP(id, id);
+    using value_type = std::int64_t;
+    static constexpr auto can_be_null = false;
+    static constexpr auto has_default_value = false;
+    static constexpr auto has_auto_increment = true;
+  };
+
+  struct Title : public ::sqlpp::spec_base {
+    SQLPP_NAME_TAGS_FOR_SQL_AND_CPP(title, title);
+    using value_type = ::sqlpp::varchar<255>;
+    static constexpr auto can_be_null = false;
+    static constexpr auto has_default_value = false;
+    static constexpr auto has_auto_increment = false;
+  };
+
+  struct Body : public ::sqlpp::spec_base {
+    SQLPP_NAME_TAGS_FOR_SQL_AND_CPP(body, body);
+    using value_type = ::sqlpp::text;
+    static constexpr auto can_be_null = true;
+    static constexpr auto has_default_value = false;
+    static constexpr auto has_auto_increment = false;
+  };
+
+  using _columns = ::sqlpp::type_vector<Id, Title, Body>;
+
+  using primary_key = ::sqlpp::type_vector<Id>;
+};
+inline constexpr auto tabNote = ::sqlpp::table_t<TabNote>{};
+
+using ::sqlpp::test::expect;
+
+// Short and long values alternate, so that buffers have to grow in between
+// and later values are shorter than their buffers
+const auto body_sizes = std::vector<std::optional<std::size_t>>{
+    3, 20000, 0, std::nullopt, 5, 50000, 4096, 4097, 1};
+
+template <typename Prepared>
+auto expect_notes(Prepared& prepared) -> void {
+  auto index = std::size_t{0};
+  for (const auto& row : execute(prepared)) {
+    expect(index < body_sizes.size(), "too many rows");
+    const auto& size = body_sizes[index];
+    expect(row.title == std::string(index + 1, 't'), "unexpected title");
+    expect(row.body.has_value() == size.has_value(), "unexpected NULL");
+    if (size) {
+      expect(*row.body == std::string(*size, 'b'), "unexpected body");
+    }
+    ++index;
+  }
+  expect(index == body_sizes.size(), "too few rows");
+}
+}  // namespace
+
+namespace mysql = sqlpp::mysql;
+int main() {
+  try {
+    mysql::global_library_init();
+
+    const auto config = mysql::test::get_config();
+    auto db = mysql::connection_t<sqlpp::debug::none>{config};
+    db(drop_table(tabNote));
+    db(create_table(tabNote));
+    for (auto i = std::size_t{0}; i < body_sizes.size(); ++i) {
+      const auto& size = body_sizes[i];
+      const auto title = std::string(i + 1, 't');
+      if (size) {
+        db(insert_into(tabNote).set(tabNote.title = title,
+                                    tabNote.body = std::string(*size, 'b')));
+      } else {
+        db(insert_into(tabNote).set(tabNote.title = title,
+                                    tabNote.body = std::nullopt));
+      }
+    }
+
+    auto prepared_select = db.prepare(select(tabNote.title, tabNote.body)
+                                          .from(tabNote)
+                                          .order_by(tabNote.id.asc()));
+
+    // Stored results size their buffers by the longest value
+    expect_notes(prepared_select);
+
+    // Cursors start with buffers of the column's length (capped)
+    prepared_select.use_cursor(2);
+    expect_notes(prepared_select);
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,168 @@
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/mysql/connection_pool.h>
+#include <sqlpp20/mysql_test/get_config.h>
+#include <sqlpp20/parameter.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+using test::tabPerson;
+SQLPP_CREATE_NAME_TAG(pName);
+
+using ::sqlpp::test::expect;
+using ::sqlpp::test::expect_exception;
+
+}  // namespace
+
+namespace mysql = sqlpp::mysql;
+int main() {
+  try {
+    mysql::global_library_init();
+
+    const auto config = mysql::test::get_config();
+    auto db = mysql::connection_t<sqlpp::debug::none>{config};
+    db(drop_table(tabPerson));
+    db(create_table(tabPerson));
+    for (auto i = 0; i < 100; ++i) {
+      db(insert_into(tabPerson).set(tabPerson.isManager = (i % 10 == 0),
+                                    tabPerson.name =
+                                        "person " + std::to_string(i)));
+    }
+
+    // All rows, read completely
+    {
+      auto count = 0;
+      for (const auto& row :
+           db.stream(select(tabPerson.id, tabPerson.name)
+                         .from(tabPerson)
+                         .unconditionally())) {
+        expect(row.name.starts_with("person "), "unexpected name");
+        if (count == 0) {
+          expect(db.is_busy(), "connection not busy while streaming");
+          expect_exception(
+              [&] {
+                db(select(tabPerson.id).from(tabPerson).unconditionally());
+              },
+              "statement executed during unbuffered result");
+        }
+        ++count;
+      }
+      expect(count == 100, "unexpected number of streamed rows");
+      expect(not db.is_busy(), "connection still busy after last row");
+    }
+
+    // Statements prepared before streaming are rejected as well
+    {
+      auto prepared_select =
+          db.prepare(select(tabPerson.id).from(tabPerson).unconditionally());
+      auto prepared_insert = db.prepare(insert_into(tabPerson).set(
+          tabPerson.isManager = false,
+          tabPerson.name = ::sqlpp::parameter<std::string>(pName)));
+      auto parameter_sets =
+          std::vector<decltype(prepared_insert.parameters)>(2);
+      parameter_sets[0].pName = "batch 0";
+      parameter_sets[1].pName = "batch 1";
+
+      {
+        auto result = db.stream(
+            select(tabPerson.id).from(tabPerson).unconditionally());
+        expect(not result.empty(), "no streamed rows");
+        expect_exception([&] { prepared_select.execute(); },
+                         "prepared statement executed while busy");
+        expect_exception([&] { prepared_insert.execute(); },
+                         "prepared statement executed while busy");
+        expect_exception([&] { prepared_insert.execute_batch(parameter_sets); },
+                         "prepared statement executed while busy");
+      }
+
+      auto count = 0;
+      for ([[maybe_unused]] const auto& row : prepared_select.execute()) {
+        ++count;
+      }
+      expect(count == 100, "unexpected number of rows after streaming");
+    }
+
+    // Destroying the result early frees the connection
+    {
+      auto result = db.stream(select(tabPerson.id)
+                                  .from(tabPerson)
+                                  .where(tabPerson.isManager == true));
+      expect(not result.empty(), "no streamed managers");
+      expect(db.is_busy(), "connection not busy while streaming");
+    }
+    expect(not db.is_busy(), "connection still busy after destroyed result");
+
+    auto managers = 0;
+    for ([[maybe_unused]] const auto& row :
+         db(select(tabPerson.id)
+                .from(tabPerson)
+                .where(tabPerson.isManager == true))) {
+      ++managers;
+    }
+    expect(managers == 10, "unexpected number of managers");
+
+    // Pooled connections destroyed before their unbuffered result do not
+    // return to the pool while the result reads from them
+    {
+      auto pool = mysql::connection_pool_t<sqlpp::debug::none>{1, config};
+      auto result = [&pool] {
+        auto connection = pool.get();
+        return connection.stream(
+            select(tabPerson.id).from(tabPerson).unconditionally());
+      }();
+      expect(not result.empty(), "no streamed rows");
+
+      auto connection = pool.get();
+      expect(not connection.is_busy(), "new pooled connection is busy");
+      auto count = 0;
+      for ([[maybe_unused]] const auto& row :
+           connection(select(tabPerson.id).from(tabPerson).unconditionally())) {
+        ++count;
+      }
+      expect(count == 100, "unexpected number of rows on pooled connection");
+
+      count = 0;
+      for ([[maybe_unused]] const auto& row : result) {
+        ++count;
+      }
+      expect(count == 100, "unexpected number of rows after connection drop");
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -27,15 +27,25 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/postgresql/context.h>
+#include <sqlpp20/sql_length_estimate.h>
 
+#include <cstddef>
 #include <string>
 #include <type_traits>
 
 namespace sqlpp {
 template <typename T>
-[[nodiscard]] auto to_sql_string(postgresql::context_t& context, const T& b)
-    -> std::enable_if_t<std::is_same_v<T, bool>, std::string> {
-  return b ? std::string("TRUE") : std::string("FALSE");
+constexpr auto serialize(postgresql::context_t& context, std::string& sql,
+                         const T& b)
+    -> std::enable_if_t<std::is_same_v<T, bool>, void> {
+  if (detail::serialize_lifted_literal(context, sql, b)) return;
+  sql += b ? "TRUE" : "FALSE";
+}
+
+template <typename T>
+auto sql_length_estimate(const postgresql::context_t&, const T& b)
+    -> std::enable_if_t<std::is_same_v<T, bool>, std::size_t> {
+  return b ? sql_length("TRUE") : sql_length("FALSE");
 }
 
 }  // namespace sqlpp
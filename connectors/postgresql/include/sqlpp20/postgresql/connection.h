@@ -26,8 +26,10 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/chunked_insert.h>
 #include <sqlpp20/clause/command.h>
 #include <sqlpp20/connection.h>
+#include <sqlpp20/literal_parameters.h>
 #include <sqlpp20/postgresql/bool.h>
 #include <sqlpp20/postgresql/char_result.h>
 #include <sqlpp20/postgresql/clause.h>
@@ -38,10 +40,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlpp20/postgresql/prepared_statement.h>
 #include <sqlpp20/postgresql/to_sql_string.h>
 #include <sqlpp20/result.h>
+#include <sqlpp20/sql_string_cache.h>
 #include <sqlpp20/statement.h>
+#include <sqlpp20/static_sql_string.h>
 
+#include <cstdint>
 #include <functional>
+#include <string>
 #include <type_traits>
+#include <variant>
+#include <vector>
 
 namespace sqlpp::postgresql {
 template <typename Pool, ::sqlpp::debug Debug>
@@ -63,18 +71,77 @@ class connection_cleanup_t {
 using unique_connection_ptr =
     std::unique_ptr<PGconn, detail::connection_cleanup_t>;
 
-template <typename Connection, typename Statement>
-auto execute(const Connection& connection, const Statement& statement)
-    -> detail::unique_result_ptr {
-  const auto sql_string = to_sql_string_c(context_t{}, statement);
+// Types of lifted literals (see catalog/pg_type_d.h), so that the server
+// resolves operators and result columns as it does for inlined literals.
+// Strings stay of unknown type, like quoted literals in the SQL text, which
+// the server casts to the type of the other operand (e.g. dates).
+inline auto literal_parameter_type(const literal_parameter_t& literal) -> Oid {
+  constexpr auto bool_oid = Oid{16};
+  constexpr auto int8_oid = Oid{20};
+  constexpr auto float8_oid = Oid{701};
+  constexpr auto unknown_oid = Oid{705};
+  return std::visit(
+      [](const auto& value) -> Oid {
+        using _value_t = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<_value_t, bool>) {
+          return bool_oid;
+        } else if constexpr (std::is_same_v<_value_t, std::int64_t>) {
+          return int8_oid;
+        } else if constexpr (std::is_same_v<_value_t, double>) {
+          return float8_oid;
+        } else {
+          return unknown_oid;
+        }
+      },
+      literal);
+}
 
+// Text format of a lifted literal, as passed to PQexecParams
+inline auto literal_parameter_to_text(const literal_parameter_t& literal)
+    -> std::string {
+  return std::visit(
+      [](const auto& value) -> std::string {
+        using _value_t = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<_value_t, bool>) {
+          return value ? "TRUE" : "FALSE";
+        } else if constexpr (std::is_same_v<_value_t, std::string>) {
+          return value;
+        } else {
+          return to_sql_string_c(context_t{}, value);
+        }
+      },
+      literal);
+}
+
+template <typename Connection>
+auto execute_sql(const Connection& connection, const std::string& sql_string,
+                 const literal_parameters_t& literals)
+    -> detail::unique_result_ptr {
   if (Connection::is_debug_allowed())
     connection.debug("Executing: '" + sql_string + "'");
 
+  auto values = std::vector<std::string>{};
+  auto value_pointers = std::vector<const char*>{};
+  auto types = std::vector<Oid>{};
+  values.reserve(literals.size());
+  value_pointers.reserve(literals.size());
+  types.reserve(literals.size());
+  for (const auto& literal : literals) {
+    values.push_back(literal_parameter_to_text(literal));
+    value_pointers.push_back(values.back().c_str());
+    types.push_back(literal_parameter_type(literal));
+  }
+
   // If one day we switch to binary format, then we could use PQexecParams with
   // resultFormat=1
   auto result = detail::unique_result_ptr(
-      PQexec(connection.get(), sql_string.c_str()), {});
+      literals.empty()
+          ? PQexec(connection.get(), sql_string.c_str())
+          : PQexecParams(connection.get(), sql_string.c_str(),
+                         static_cast<int>(value_pointers.size()),
+                         types.data(), value_pointers.data(), nullptr, nullptr,
+                         0),
+      {});
 
   if (not result) {
     throw sqlpp::exception("Postgresql: out of memory (query was >>" +
@@ -94,6 +161,23 @@ auto execute(const Connection& connection, const Statement& statement)
   }
 }
 
+template <typename Connection, typename Statement>
+auto execute(const Connection& connection, const Statement& statement)
+    -> detail::unique_result_ptr {
+  // Generic statements (e.g. DDL) keep their literals, as they do not accept
+  // placeholders everywhere.
+  if (std::is_same_v<result_type_of_t<Statement>, execute_result> or
+      not connection.parameterize_literals()) {
+    return execute_sql(connection,
+                       to_sql_string_cached(context_t{}, statement), {});
+  }
+
+  auto literals = literal_parameters_t{};
+  auto context = context_t{};
+  context.literal_parameters = &literals;
+  return execute_sql(connection, to_sql_string(context, statement), literals);
+}
+
 // direct execution
 inline auto config_field_to_string(std::string_view name,
                                    const std::optional<std::string>& value)
@@ -124,8 +208,10 @@ class base_connection : public ::sqlpp::connection,
   using _debug_base = ::sqlpp::debug_base<Debug>;
   detail::unique_connection_ptr _handle;
   bool _transaction_active = false;
+  bool _parameterize_literals = false;
 
   mutable std::size_t _statement_index = 0;
+  std::uint64_t _affected_rows = 0;
 
   template <typename... Clauses>
   friend class ::sqlpp::statement;
@@ -139,7 +225,8 @@ class base_connection : public ::sqlpp::connection,
                   detail::unique_connection_ptr&& handle, Pool* connection_pool)
       : _pool_base{connection_pool},
         _debug_base{config.debug},
-        _handle{std::move(handle)} {}
+        _handle{std::move(handle)},
+        _parameterize_literals{config.parameterize_literals} {}
 
   base_connection(const connection_config_t& config, Pool* connection_pool)
       : base_connection{config} {
@@ -147,9 +234,13 @@ class base_connection : public ::sqlpp::connection,
   }
 
  public:
+  using context_type = context_t;
+
   base_connection() = delete;
   base_connection(const connection_config_t& config)
-      : _debug_base{config.debug}, _handle{nullptr, {}} {
+      : _debug_base{config.debug},
+        _handle{nullptr, {}},
+        _parameterize_literals{config.parameterize_literals} {
     if (config.pre_connect) {
       config.pre_connect(get());
     }
@@ -225,13 +316,17 @@ class base_connection : public ::sqlpp::connection,
                   _check) {
       using ResultType = result_type_of_t<Statement>;
       if constexpr (std::is_same_v<ResultType, insert_result>) {
-        return PQoidValue(detail::execute(*this, statement).get());
+        const auto result = detail::execute(*this, statement);
+        _affected_rows = std::strtoull(PQcmdTuples(result.get()), nullptr, 10);
+        return PQoidValue(result.get());
       } else if constexpr (std::is_same_v<ResultType, delete_result>) {
-        return std::strtoll(
-            PQcmdTuples(detail::execute(*this, statement).get()), nullptr, 10);
+        const auto result = detail::execute(*this, statement);
+        _affected_rows = std::strtoull(PQcmdTuples(result.get()), nullptr, 10);
+        return static_cast<long long>(_affected_rows);
       } else if constexpr (std::is_same_v<ResultType, update_result>) {
-        return std::strtoll(
-            PQcmdTuples(detail::execute(*this, statement).get()), nullptr, 10);
+        const auto result = detail::execute(*this, statement);
+        _affected_rows = std::strtoull(PQcmdTuples(result.get()), nullptr, 10);
+        return static_cast<long long>(_affected_rows);
       } else if constexpr (std::is_same_v<ResultType, select_result>) {
         auto result = detail::execute(*this, statement);
 
@@ -261,6 +356,26 @@ class base_connection : public ::sqlpp::connection,
     }
   }
 
+  // Prepares a constexpr statement (with static storage duration) using SQL
+  // text that has been generated at compile time.
+  template <const auto& Statement>
+  auto prepare() {
+    using _statement_t = std::remove_cvref_t<decltype(Statement)>;
+    if constexpr (constexpr auto _check =
+                      check_statement_preparable<base_connection>(
+                          type_v<_statement_t>);
+                  _check) {
+      return ::sqlpp::postgresql::prepared_statement_t<
+          result_type_of_t<_statement_t>, parameters_of_t<_statement_t>,
+          result_row_of_t<_statement_t>>{
+          *this, ::sqlpp::static_sql_string_v<context_t, Statement>.c_str()};
+    } else {
+      return ::sqlpp::bad_expression_t{_check};
+    }
+  }
+
+  auto is_transaction_active() const -> bool { return _transaction_active; }
+
   auto start_transaction() -> void {
     if (_transaction_active) {
       throw sqlpp::exception(
@@ -315,6 +430,22 @@ class base_connection : public ::sqlpp::connection,
 
   auto* get() const { return _handle.get(); }
 
+  auto parameterize_literals() const -> bool { return _parameterize_literals; }
+
+  // Queries are limited to 1GB, the protocol allows for 65535 parameters
+  auto insert_chunk_limits() const -> insert_chunk_limits_t {
+    auto limits = insert_chunk_limits_t{};
+    limits.max_sql_length = (std::size_t{1} << 30) / 2;
+    if (_parameterize_literals) {
+      limits.max_parameters = 65535;
+    }
+    return limits;
+  }
+
+  // Rows inserted, updated or deleted by the last such statement executed
+  // directly (not prepared)
+  auto affected_rows() const -> std::uint64_t { return _affected_rows; }
+
   auto is_alive() -> bool { return PQstatus(_handle.get()) == CONNECTION_OK; }
 
   auto get_statement_index() const { return ++_statement_index; }
@@ -65,6 +65,9 @@ struct connection_config_t {
   std::optional<std::string> target_session_attrs;
 
   std::function<void(std::string_view)> debug;
+  // Directly executed statements send their literal values as parameters
+  // instead of embedding them into the SQL text.
+  bool parameterize_literals = false;
 
   connection_config_t() = default;
   connection_config_t(const connection_config_t&) = default;
@@ -31,10 +31,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace sqlpp {
 template <typename L, typename R>
-[[nodiscard]] auto to_sql_string(const postgresql::context_t& context,
-                                 const bit_xor_t<L, R>& t) {
-  return to_sql_string(context, embrace(t.l)) + " # " +
-         to_sql_string(connection, embrace(t.r));
+constexpr auto serialize(postgresql::context_t& context, std::string& sql,
+                         const bit_xor_t<L, R>& t) -> void {
+  serialize(context, sql, embrace(t.l));
+  sql += " # ";
+  serialize(context, sql, embrace(t.r));
 }
 
 }  // namespace sqlpp
@@ -28,6 +28,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <libpq-fe.h>
 #include <sqlpp20/prepared_statement_parameters.h>
+#include <sqlpp20/result.h>
+#include <sqlpp20/sql_string_cache.h>
 
 #include <array>
 #include <functional>
@@ -64,26 +66,36 @@ inline auto bind_parameter(std::string& parameter_string,
 inline auto bind_parameter(std::string& parameter_string,
                            char*& parameter_pointer, std::int32_t& value)
     -> void {
-  parameter_string = std::to_string(value);
+  // The parameter strings are reused for each execution, so numbers are
+  // written into the existing buffer instead of a new string.
+  auto context = ::sqlpp::postgresql::context_t{};
+  parameter_string.clear();
+  serialize(context, parameter_string, value);
   parameter_pointer = parameter_string.data();
 }
 
 inline auto bind_parameter(std::string& parameter_string,
                            char*& parameter_pointer, std::int64_t& value)
     -> void {
-  parameter_string = std::to_string(value);
+  auto context = ::sqlpp::postgresql::context_t{};
+  parameter_string.clear();
+  serialize(context, parameter_string, value);
   parameter_pointer = parameter_string.data();
 }
 
 inline auto bind_parameter(std::string& parameter_string,
                            char*& parameter_pointer, float& value) -> void {
-  parameter_string = to_sql_string_c(::sqlpp::postgresql::context_t{}, value);
+  auto context = ::sqlpp::postgresql::context_t{};
+  parameter_string.clear();
+  serialize(context, parameter_string, value);
   parameter_pointer = parameter_string.data();
 }
 
 inline auto bind_parameter(std::string& parameter_string,
                            char*& parameter_pointer, double& value) -> void {
-  parameter_string = to_sql_string_c(::sqlpp::postgresql::context_t{}, value);
+  auto context = ::sqlpp::postgresql::context_t{};
+  parameter_string.clear();
+  serialize(context, parameter_string, value);
   parameter_pointer = parameter_string.data();
 }
 
@@ -140,24 +152,23 @@ class prepared_statement_t {
   ::sqlpp::prepared_statement_parameters<ParameterVector> parameters = {};
 
   prepared_statement_t() = default;
-  template <typename Connection, typename Statement>
-  prepared_statement_t(const Connection& connection, const Statement& statement)
+  template <typename Connection>
+  prepared_statement_t(const Connection& connection, const char* sql_string)
       : _name(std::to_string(connection.get_statement_index()) + "at" +
               std::to_string(::time(nullptr))),
         _connection(connection.get(), {_name}) {
-    const auto sql_string = to_sql_string_c(context_t{}, statement);
-
     if constexpr (Connection::is_debug_allowed())
       connection.debug("Preparing " + _name + ": '" + sql_string + "'");
 
     auto result = detail::unique_result_ptr(
-        PQprepare(connection.get(), _name.c_str(), sql_string.c_str(),
+        PQprepare(connection.get(), _name.c_str(), sql_string,
                   ParameterVector::size(), nullptr),
         {});
 
     if (not result) {
-      throw sqlpp::exception("Postgresql: out of memory (query was >>" +
-                             sql_string + "<<\n");
+      throw sqlpp::exception(
+          std::string("Postgresql: out of memory (query was >>") + sql_string +
+          "<<\n");
     }
 
     switch (PQresultStatus(result.get())) {
@@ -172,6 +183,13 @@ class prepared_statement_t {
             "<<\n");
     }
   }
+
+  template <typename Connection, typename Statement>
+  prepared_statement_t(const Connection& connection, const Statement& statement)
+      : prepared_statement_t{
+            connection,
+            to_sql_string_cached(context_t{}, statement).c_str()} {}
+
   prepared_statement_t(const prepared_statement_t&) = delete;
   prepared_statement_t(prepared_statement_t&& rhs) = default;
   prepared_statement_t& operator=(const prepared_statement_t&) = delete;
@@ -29,6 +29,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlpp20/postgresql/context.h>
 #include <sqlpp20/to_sql_string.h>
 
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
 namespace sqlpp {
 [[nodiscard]] inline auto nan_to_sql_string(
     ::sqlpp::postgresql::context_t& context) -> std::string {
@@ -45,4 +50,16 @@ namespace sqlpp {
   return std::string{"-Infinity"};
 }
 
+// PostgreSQL reads X'..' as a bit string, bytea literals use the hex format
+inline auto serialize(::sqlpp::postgresql::context_t&, std::string& sql,
+                      const std::span<const std::uint8_t>& t) -> void {
+  constexpr auto digits = std::string_view{"0123456789abcdef"};
+  sql += "'\\x";
+  for (const auto byte : t) {
+    sql += digits[byte >> 4];
+    sql += digits[byte & 0x0F];
+  }
+  sql += "'::bytea";
+}
+
 }  // namespace sqlpp
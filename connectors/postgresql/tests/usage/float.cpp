@@ -28,6 +28,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlpp20/postgresql_test/get_config.h>
 #include <sqlpp20_test/float_test.h>
 
+#include <iomanip>
+#include <limits>
+
 namespace {
 using test::tabFloat;
 
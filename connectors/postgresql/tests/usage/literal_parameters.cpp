@@ -0,0 +1,83 @@
+/*
+Copyright (c) 2018 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/name_tag.h>
+#include <sqlpp20/operator.h>
+#include <sqlpp20/postgresql/connection.h>
+#include <sqlpp20/postgresql_test/get_config.h>
+#include <sqlpp20/sql_cast.h>
+#include <sqlpp20/value.h>
+#include <sqlpp20_test/expect.h>
+
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+namespace alias {
+SQLPP_CREATE_NAME_TAG(x);
+SQLPP_CREATE_NAME_TAG(y);
+}  // namespace alias
+
+using ::sqlpp::test::expect;
+}  // namespace
+
+namespace postgresql = ::sqlpp::postgresql;
+int main() {
+  try {
+    auto config = postgresql::test::get_config();
+    config.parameterize_literals = true;
+    auto db = postgresql::connection_t<::sqlpp::debug::allowed>{config};
+
+    // Lifted literals are typed, so the server can resolve the operator
+    auto sums = 0;
+    for (const auto& row :
+         db(select(as(::sqlpp::sql_cast<std::int64_t>(
+                          ::sqlpp::value(std::int64_t{1}) +
+                          ::sqlpp::value(std::int64_t{2})),
+                      alias::x),
+                   as(::sqlpp::sql_cast<double>(::sqlpp::value(0.5) *
+                                                ::sqlpp::value(4.0)),
+                      alias::y)))) {
+      expect(row.x == 3, "unexpected sum");
+      expect(row.y == 2.0, "unexpected product");
+      ++sums;
+    }
+    expect(sums == 1, "unexpected number of rows");
+
+    // ... and result columns come back in their own type, not as text
+    for (const auto& row :
+         db(select(as(::sqlpp::value(std::int64_t{42}), alias::x),
+                   as(::sqlpp::value(true), alias::y)))) {
+      expect(row.x == 42, "unexpected integer");
+      expect(row.y, "unexpected bool");
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
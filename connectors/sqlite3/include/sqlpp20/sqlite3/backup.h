@@ -0,0 +1,101 @@
+#pragma once
+
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/exception.h>
+#include <sqlpp20/sqlite3/pragma.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+namespace sqlpp::sqlite3::detail {
+// Copies all pages of the source's main database in one pass
+inline auto backup_database(::sqlite3* destination, ::sqlite3* source)
+    -> void {
+  auto* backup = sqlite3_backup_init(destination, "main", source, "main");
+  if (not backup) {
+    throw sqlpp::exception("Sqlite3: Could not start backup: " +
+                           std::string(sqlite3_errmsg(destination)));
+  }
+  const auto step_rc = sqlite3_backup_step(backup, -1);
+  const auto finish_rc = sqlite3_backup_finish(backup);
+  if (step_rc != SQLITE_DONE or finish_rc != SQLITE_OK) {
+    throw sqlpp::exception(
+        "Sqlite3: Could not copy database: " +
+        std::string(sqlite3_errstr(step_rc != SQLITE_DONE ? step_rc
+                                                          : finish_rc)));
+  }
+}
+
+inline auto open_backup_file(const std::string& path, int flags)
+    -> std::unique_ptr<::sqlite3, int (*)(::sqlite3*)> {
+  ::sqlite3* connection = nullptr;
+  const auto rc = sqlite3_open_v2(path.c_str(), &connection, flags, nullptr);
+  auto handle = std::unique_ptr<::sqlite3, int (*)(::sqlite3*)>{
+      connection, &sqlite3_close_v2};
+  if (rc != SQLITE_OK) {
+    throw sqlpp::exception("Sqlite3: Can't open database " + path + ": " +
+                           std::string(sqlite3_errmsg(connection)));
+  }
+  return handle;
+}
+
+// Serializes loads of the same database within the process, where shared
+// in-memory databases live
+inline auto load_mutex(const std::string& database_name) -> std::mutex& {
+  static auto mutex = std::mutex{};
+  static auto mutexes = std::map<std::string, std::mutex>{};
+  const auto lock = std::scoped_lock{mutex};
+  return mutexes[database_name];
+}
+
+// Leaves databases that have content already as they are, e.g. shared
+// in-memory databases that have been loaded by another connection
+inline auto load_database(::sqlite3* destination, const std::string& path)
+    -> void {
+  const auto* name = sqlite3_db_filename(destination, "main");
+  const auto lock = std::scoped_lock{load_mutex(name ? name : "")};
+  if (execute_pragma(destination, "PRAGMA page_count") != "0") return;
+  const auto source = open_backup_file(path, SQLITE_OPEN_READONLY);
+  backup_database(destination, source.get());
+}
+
+inline auto save_database(::sqlite3* source, const std::string& path)
+    -> void {
+  const auto destination =
+      open_backup_file(path, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
+  backup_database(destination.get(), source);
+}
+}  // namespace sqlpp::sqlite3::detail
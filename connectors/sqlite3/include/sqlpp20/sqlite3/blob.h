@@ -0,0 +1,179 @@
+#pragma once
+
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/data_types.h>
+#include <sqlpp20/exception.h>
+#include <sqlpp20/sqlite3/context.h>
+#include <sqlpp20/to_sql_string.h>
+#include <sqlpp20/type_traits.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+namespace sqlpp::sqlite3 {
+// A blob of `size` zero bytes, to be filled by blob_stream_t::write()
+struct zeroblob_t {
+  std::int64_t size;
+};
+
+[[nodiscard]] constexpr auto zeroblob(std::int64_t size) -> zeroblob_t {
+  return zeroblob_t{size};
+}
+
+enum class blob_mode { read_only, read_write };
+
+// Incremental I/O on a single blob (or text) value, see sqlite3_blob_open.
+// The value cannot change its size. Changing the row by other means makes
+// the stream fail with SQLITE_ABORT.
+class blob_stream_t {
+  struct blob_cleanup_t {
+    auto operator()(::sqlite3_blob* blob) const noexcept -> void {
+      sqlite3_blob_close(blob);
+    }
+  };
+
+  ::sqlite3* _connection;
+  std::unique_ptr<::sqlite3_blob, blob_cleanup_t> _blob;
+
+  auto check(int rc, const char* action) const -> void {
+    if (rc != SQLITE_OK) {
+      throw sqlpp::exception(std::string("Sqlite3: Could not ") + action +
+                             " blob: " + sqlite3_errmsg(_connection));
+    }
+  }
+
+  auto handle() const -> ::sqlite3_blob* {
+    if (not _blob) {
+      throw sqlpp::exception("Sqlite3: Blob stream has been moved from");
+    }
+    return _blob.get();
+  }
+
+  // sqlite3_blob_* take sizes and offsets as int
+  static auto to_int(std::size_t value, const char* what) -> int {
+    if (not std::in_range<int>(value)) {
+      throw sqlpp::exception(std::string("Sqlite3: Blob ") + what + " of " +
+                             std::to_string(value) + " exceeds int");
+    }
+    return static_cast<int>(value);
+  }
+
+ public:
+  blob_stream_t(::sqlite3* connection, const std::string& schema,
+                const std::string& table, const std::string& column,
+                std::int64_t rowid, blob_mode mode)
+      : _connection(connection) {
+    ::sqlite3_blob* blob = nullptr;
+    const auto rc = sqlite3_blob_open(
+        connection, schema.c_str(), table.c_str(), column.c_str(), rowid,
+        mode == blob_mode::read_write ? 1 : 0, &blob);
+    _blob.reset(blob);
+    check(rc, "open");
+  }
+  blob_stream_t(const blob_stream_t&) = delete;
+  blob_stream_t(blob_stream_t&&) = default;
+  blob_stream_t& operator=(const blob_stream_t&) = delete;
+  blob_stream_t& operator=(blob_stream_t&&) = default;
+  ~blob_stream_t() = default;
+
+  [[nodiscard]] auto size() const -> std::size_t {
+    return static_cast<std::size_t>(sqlite3_blob_bytes(handle()));
+  }
+
+  // Fills `buffer` with the bytes starting at `offset`
+  auto read(std::span<std::uint8_t> buffer, std::size_t offset) const
+      -> void {
+    check(sqlite3_blob_read(handle(), buffer.data(),
+                            to_int(buffer.size(), "read size"),
+                            to_int(offset, "offset")),
+          "read");
+  }
+
+  auto write(std::span<const std::uint8_t> data, std::size_t offset) -> void {
+    check(sqlite3_blob_write(handle(), data.data(),
+                             to_int(data.size(), "write size"),
+                             to_int(offset, "offset")),
+          "write");
+  }
+
+  // Reads the whole value in chunks of at most buffer.size() bytes and hands
+  // each chunk to `consume`
+  template <typename Consumer>
+  auto read_chunks(std::span<std::uint8_t> buffer, Consumer&& consume) const
+      -> void {
+    if (buffer.empty()) {
+      throw sqlpp::exception("Sqlite3: Cannot read blob chunks into an empty "
+                             "buffer");
+    }
+    const auto total = size();
+    for (auto offset = std::size_t{0}; offset < total;) {
+      const auto chunk = buffer.first(std::min(buffer.size(), total - offset));
+      read(chunk, offset);
+      consume(std::span<const std::uint8_t>{chunk});
+      offset += chunk.size();
+    }
+  }
+
+  // Moves to the same column of another row, which is cheaper than opening
+  // a new stream
+  auto reopen(std::int64_t rowid) -> void {
+    check(sqlite3_blob_reopen(handle(), rowid), "reopen");
+  }
+};
+}  // namespace sqlpp::sqlite3
+
+namespace sqlpp {
+template <>
+struct value_type_of<::sqlpp::sqlite3::zeroblob_t> {
+  using type = ::sqlpp::blob;
+};
+
+inline auto serialize(sqlite3::context_t&, std::string& sql,
+                      const ::sqlpp::sqlite3::zeroblob_t& t) -> void {
+  sql += "zeroblob(";
+  detail::serialize_integral(sql, t.size);
+  sql += ")";
+}
+
+inline auto sql_length_estimate(const sqlite3::context_t&,
+                                const ::sqlpp::sqlite3::zeroblob_t&)
+    -> std::size_t {
+  return sql_length("zeroblob()") + 20;
+}
+}  // namespace sqlpp
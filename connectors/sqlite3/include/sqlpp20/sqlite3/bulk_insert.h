@@ -0,0 +1,178 @@
+#pragma once
+
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/exception.h>
+#include <sqlpp20/free_column.h>
+#include <sqlpp20/sqlite3/context.h>
+#include <sqlpp20/sqlite3/pragma.h>
+#include <sqlpp20/tuple_to_sql_string.h>
+#include <sqlpp20/type_traits.h>
+#include <sqlpp20/wrong.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+namespace sqlpp::sqlite3 {
+struct bulk_insert_options_t {
+  // Rows per transaction. If the connection has an open transaction already,
+  // all rows are inserted within that one.
+  std::size_t rows_per_transaction = 10000;
+  // Sets `PRAGMA synchronous = OFF` and (unless in WAL mode) `PRAGMA
+  // journal_mode = MEMORY` for the duration of the load. A crash during the
+  // load can corrupt the database then. Ignored within an open transaction.
+  bool relax_durability = false;
+};
+
+struct bulk_insert_result_t {
+  std::size_t rows = 0;
+  std::chrono::steady_clock::duration duration = {};
+
+  auto rows_per_second() const -> double {
+    const auto seconds = std::chrono::duration<double>(duration).count();
+    return seconds > 0 ? static_cast<double>(rows) / seconds : 0.0;
+  }
+};
+}  // namespace sqlpp::sqlite3
+
+namespace sqlpp::sqlite3::detail {
+inline auto bind_bulk_value(::sqlite3_stmt* statement, int index,
+                            const std::nullopt_t&) -> int {
+  return sqlite3_bind_null(statement, index);
+}
+
+// Values are bound without copies, they outlive the execution of the row
+template <typename T>
+auto bind_bulk_value(::sqlite3_stmt* statement, int index, const T& value)
+    -> int {
+  if constexpr (std::is_integral_v<T>) {
+    return sqlite3_bind_int64(statement, index,
+                              static_cast<sqlite3_int64>(value));
+  } else if constexpr (std::is_floating_point_v<T>) {
+    return sqlite3_bind_double(statement, index, static_cast<double>(value));
+  } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+    const auto text = std::string_view{value};
+    return sqlite3_bind_text(statement, index, text.data(),
+                             static_cast<int>(text.size()), SQLITE_STATIC);
+  } else {
+    static_assert(wrong<T>, "bulk_insert supports plain values only");
+  }
+}
+
+template <typename T>
+auto bind_bulk_value(::sqlite3_stmt* statement, int index,
+                     const std::optional<T>& value) -> int {
+  return value ? bind_bulk_value(statement, index, *value)
+               : bind_bulk_value(statement, index, std::nullopt);
+}
+
+template <typename... Assignments>
+auto bulk_insert_row(::sqlite3* connection, ::sqlite3_stmt* statement,
+                     const std::tuple<Assignments...>& row) -> void {
+  static_assert((not is_optional_v<Assignments> and ...),
+                "bulk_insert requires all columns to be set in each row");
+  auto index = 0;
+  const auto bind = [&](const auto& value) {
+    if (const auto rc = bind_bulk_value(statement, ++index, value);
+        rc != SQLITE_OK) {
+      throw sqlpp::exception("Sqlite3: Could not bind bulk insert value: " +
+                             std::string(sqlite3_errstr(rc)));
+    }
+  };
+  (bind(std::get<Assignments>(row).value), ...);
+
+  const auto rc = sqlite3_step(statement);
+  // Reset right away, so that the statement does not stay active
+  sqlite3_reset(statement);
+  if (rc != SQLITE_DONE) {
+    throw sqlpp::exception("Sqlite3: Could not execute bulk insert: " +
+                           std::string(sqlite3_errmsg(connection)));
+  }
+}
+
+template <typename Table, typename... Assignments>
+auto bulk_insert_sql(const Table& table, type_t<std::tuple<Assignments...>>)
+    -> std::string {
+  auto context = context_t{};
+  auto sql = to_sql_string(context, insert_into(table));
+  sql += " (";
+  serialize_tuple(context, sql, ", ",
+                  std::tuple(free_column_t<column_of_t<Assignments>>{}...));
+  sql += ") VALUES (";
+  for (auto i = std::size_t{0}; i < sizeof...(Assignments); ++i) {
+    if (i > 0) sql += ", ";
+    serialize_placeholder(context, sql);
+  }
+  sql += ")";
+  return sql;
+}
+
+// Trades durability for speed while it is alive (see bulk_insert_options_t)
+class relaxed_durability_t {
+  ::sqlite3* _connection;
+  std::string _synchronous;
+  std::string _journal_mode;
+
+ public:
+  explicit relaxed_durability_t(::sqlite3* connection)
+      : _connection(connection),
+        _synchronous(execute_pragma(connection, "PRAGMA synchronous")),
+        _journal_mode(execute_pragma(connection, "PRAGMA journal_mode")) {
+    execute_pragma(_connection, "PRAGMA synchronous = OFF");
+    if (_journal_mode != "wal") {
+      execute_pragma(_connection, "PRAGMA journal_mode = MEMORY");
+    }
+  }
+  relaxed_durability_t(const relaxed_durability_t&) = delete;
+  relaxed_durability_t(relaxed_durability_t&&) = delete;
+  relaxed_durability_t& operator=(const relaxed_durability_t&) = delete;
+  relaxed_durability_t& operator=(relaxed_durability_t&&) = delete;
+  ~relaxed_durability_t() {
+    try {
+      if (_journal_mode != "wal") {
+        execute_pragma(_connection, "PRAGMA journal_mode = " + _journal_mode);
+      }
+      execute_pragma(_connection, "PRAGMA synchronous = " + _synchronous);
+    } catch (...) {
+      // The settings only affect this connection, which stays usable
+    }
+  }
+};
+}  // namespace sqlpp::sqlite3::detail
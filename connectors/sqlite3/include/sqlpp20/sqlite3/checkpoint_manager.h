@@ -0,0 +1,255 @@
+#pragma once
+
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/exception.h>
+#include <sqlpp20/sqlite3/connection.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <thread>
+
+namespace sqlpp::sqlite3::detail {
+// The macro is set when building sqlite3, sqlite3.h does not provide it
+#ifdef SQLITE_DEFAULT_WAL_AUTOCHECKPOINT
+constexpr auto default_wal_autocheckpoint = SQLITE_DEFAULT_WAL_AUTOCHECKPOINT;
+#else
+constexpr auto default_wal_autocheckpoint = 1000;
+#endif
+}  // namespace sqlpp::sqlite3::detail
+
+namespace sqlpp::sqlite3 {
+struct checkpoint_config_t {
+  // Frames written since the last checkpoint that trigger a PASSIVE checkpoint
+  std::size_t passive_frames = 1000;
+  // Frames in the WAL that trigger a RESTART checkpoint, which waits for
+  // readers and writers, so that the WAL does not grow without bounds
+  std::size_t restart_frames = 10000;
+  // Uncheckpointed frames are checkpointed after this long without commits
+  std::chrono::milliseconds idle_time{500};
+  // How often the idle time is checked
+  std::chrono::milliseconds poll_interval{100};
+};
+
+struct checkpoint_statistics_t {
+  // As of the last commit or checkpoint
+  std::size_t wal_frames = 0;
+  std::size_t wal_bytes = 0;
+  std::size_t checkpointed_frames = 0;
+
+  std::size_t passive_checkpoints = 0;
+  std::size_t restart_checkpoints = 0;
+  // Checkpoints that could not complete due to concurrent readers or writers
+  std::size_t busy_checkpoints = 0;
+  std::size_t failed_checkpoints = 0;
+
+  std::chrono::steady_clock::duration last_duration = {};
+  std::chrono::steady_clock::duration max_duration = {};
+  std::chrono::steady_clock::duration total_duration = {};
+};
+
+// Runs WAL checkpoints in a background thread, using a connection of its own.
+// Connections that write to the database are attached to it, which disables
+// their automatic checkpoints. Commits on these connections thus no longer
+// pay for checkpoints.
+//
+// Attached connections have to be detached or closed before the manager is
+// destroyed.
+class checkpoint_manager_t {
+  using _clock = std::chrono::steady_clock;
+
+  checkpoint_config_t _config;
+  connection_t<::sqlpp::debug::none> _connection;
+  std::size_t _page_size;
+
+  mutable std::mutex _mutex;
+  std::condition_variable_any _condition;
+  checkpoint_statistics_t _statistics;
+  _clock::time_point _last_commit;
+  // Checkpoints blocked by readers or writers are not retried before
+  _clock::time_point _retry_after;
+
+  // Declared last, so that the thread is stopped before anything else goes
+  std::jthread _thread;
+
+  static auto checkpoint_connection_config(connection_config_t config)
+      -> connection_config_t {
+    // The connection is used by the background thread only
+    config.flags &= ~(SQLITE_OPEN_READONLY | SQLITE_OPEN_FULLMUTEX);
+    config.flags |= SQLITE_OPEN_READWRITE | SQLITE_OPEN_NOMUTEX;
+    config.statement_cache_capacity = 0;
+    return config;
+  }
+
+  // Until a connection has read the database, it does not know about the WAL
+  // and its checkpoints do nothing (older versions of sqlite3 do not open
+  // the WAL on their own). Returns the page size.
+  static auto open_wal(::sqlite3* connection) -> std::size_t {
+    detail::execute_pragma(connection, "PRAGMA journal_mode");
+    return static_cast<std::size_t>(
+        std::stoull(detail::execute_pragma(connection, "PRAGMA page_size")));
+  }
+
+  static auto on_commit(void* manager, ::sqlite3*, const char*, int frames)
+      -> int {
+    static_cast<checkpoint_manager_t*>(manager)->commit(
+        static_cast<std::size_t>(frames));
+    return SQLITE_OK;
+  }
+
+  auto commit(std::size_t frames) -> void {
+    auto notify = false;
+    {
+      const auto lock = std::scoped_lock{_mutex};
+      // The WAL has been restarted
+      if (frames < _statistics.checkpointed_frames) {
+        _statistics.checkpointed_frames = 0;
+      }
+      set_wal_frames(frames);
+      _last_commit = _clock::now();
+      _retry_after = {};
+      notify = pending_frames() >= _config.passive_frames;
+    }
+    if (notify) _condition.notify_one();
+  }
+
+  auto set_wal_frames(std::size_t frames) -> void {
+    _statistics.wal_frames = frames;
+    _statistics.wal_bytes = frames * _page_size;
+  }
+
+  [[nodiscard]] auto pending_frames() const -> std::size_t {
+    return _statistics.wal_frames - _statistics.checkpointed_frames;
+  }
+
+  [[nodiscard]] auto due() const -> bool {
+    if (_clock::now() < _retry_after) return false;
+    return _statistics.wal_frames >= _config.restart_frames or
+           pending_frames() >= _config.passive_frames or
+           (pending_frames() > 0 and
+            _clock::now() - _last_commit >= _config.idle_time);
+  }
+
+  auto run(std::stop_token stop_token) -> void {
+    auto lock = std::unique_lock{_mutex};
+    while (not stop_token.stop_requested()) {
+      if (not _condition.wait_for(lock, stop_token, _config.poll_interval,
+                                  [this] { return due(); })) {
+        continue;
+      }
+
+      const auto mode = _statistics.wal_frames >= _config.restart_frames
+                            ? SQLITE_CHECKPOINT_RESTART
+                            : SQLITE_CHECKPOINT_PASSIVE;
+      lock.unlock();
+      auto log = 0;
+      auto checkpointed = 0;
+      const auto start = _clock::now();
+      const auto rc = sqlite3_wal_checkpoint_v2(_connection.get(), nullptr,
+                                                mode, &log, &checkpointed);
+      const auto duration = _clock::now() - start;
+      lock.lock();
+
+      record(mode, rc, log, checkpointed, duration);
+    }
+  }
+
+  auto record(int mode, int rc, int log, int checkpointed,
+              _clock::duration duration) -> void {
+    _statistics.last_duration = duration;
+    _statistics.max_duration = std::max(_statistics.max_duration, duration);
+    _statistics.total_duration += duration;
+    if (rc != SQLITE_OK and rc != SQLITE_BUSY) {
+      ++_statistics.failed_checkpoints;
+      // Do not retry before the next commit
+      _statistics.checkpointed_frames = _statistics.wal_frames;
+      return;
+    }
+
+    ++(mode == SQLITE_CHECKPOINT_RESTART ? _statistics.restart_checkpoints
+                                         : _statistics.passive_checkpoints);
+    if (rc == SQLITE_BUSY or log != checkpointed) {
+      ++_statistics.busy_checkpoints;
+      // The frames stay due, retrying right away would just spin until the
+      // readers are done
+      _retry_after = _clock::now() + _config.poll_interval;
+    }
+
+    if (log < 0) {
+      // Not in WAL mode
+      set_wal_frames(0);
+      _statistics.checkpointed_frames = 0;
+    } else if (mode == SQLITE_CHECKPOINT_RESTART and rc == SQLITE_OK and
+               log == checkpointed) {
+      // The next writer starts over at the beginning of the WAL
+      set_wal_frames(0);
+      _statistics.checkpointed_frames = 0;
+    } else {
+      set_wal_frames(static_cast<std::size_t>(log));
+      _statistics.checkpointed_frames = static_cast<std::size_t>(checkpointed);
+    }
+    // Frames left over are retried after the next commit or poll interval
+    _last_commit = _clock::now();
+  }
+
+ public:
+  checkpoint_manager_t() = delete;
+  checkpoint_manager_t(const connection_config_t& connection_config,
+                       checkpoint_config_t config = {})
+      : _config(config),
+        _connection(checkpoint_connection_config(connection_config)),
+        _page_size(open_wal(_connection.get())),
+        _last_commit(_clock::now()),
+        _thread([this](std::stop_token stop_token) { run(stop_token); }) {}
+  checkpoint_manager_t(const checkpoint_manager_t&) = delete;
+  checkpoint_manager_t(checkpoint_manager_t&&) = delete;
+  checkpoint_manager_t& operator=(const checkpoint_manager_t&) = delete;
+  checkpoint_manager_t& operator=(checkpoint_manager_t&&) = delete;
+  ~checkpoint_manager_t() = default;
+
+  // Replaces automatic checkpoints of the connection
+  auto attach(::sqlite3* connection) -> void {
+    sqlite3_wal_hook(connection, &checkpoint_manager_t::on_commit, this);
+  }
+
+  // Restores the default automatic checkpoints of the connection
+  auto detach(::sqlite3* connection) -> void {
+    sqlite3_wal_hook(connection, nullptr, nullptr);
+    sqlite3_wal_autocheckpoint(connection, detail::default_wal_autocheckpoint);
+  }
+
+  [[nodiscard]] auto statistics() const -> checkpoint_statistics_t {
+    const auto lock = std::scoped_lock{_mutex};
+    return _statistics;
+  }
+};
+}  // namespace sqlpp::sqlite3
@@ -38,15 +38,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace sqlpp::sqlite3::detail {
 template <typename TableSpec, typename ColumnSpec>
-[[nodiscard]] auto to_sql_column_spec_string(sqlite3::context_t& context,
-                                             [[maybe_unused]] const TableSpec&,
-                                             const ColumnSpec& columnSpec) {
-  auto ret = to_sql_name(context, columnSpec) +
-             value_type_to_sql_string(
-                 context, type_t<typename ColumnSpec::value_type>{});
+constexpr auto serialize_column_spec(sqlite3::context_t& context,
+                                     std::string& sql,
+                                     [[maybe_unused]] const TableSpec&,
+                                     const ColumnSpec& columnSpec) -> void {
+  sql += to_sql_name(context, columnSpec);
+  sql += value_type_to_sql_string(context,
+                                  type_t<typename ColumnSpec::value_type>{});
 
   if constexpr (not ColumnSpec::can_be_null) {
-    ret += " NOT NULL";
+    sql += " NOT NULL";
   }
 
   if constexpr (ColumnSpec::has_auto_increment) {
@@ -57,33 +58,21 @@ template <typename TableSpec, typename ColumnSpec>
     static_assert(std::is_same_v<typename TableSpec::primary_key,
                                  ::sqlpp::type_vector<ColumnSpec>>,
                   "auto increment columns must be integer primary key");
-    ret += " PRIMARY KEY AUTOINCREMENT";
+    sql += " PRIMARY KEY AUTOINCREMENT";
   } else if constexpr (ColumnSpec::has_default_value) {
-    ret += " DEFAULT " + to_sql_string(context, columnSpec.default_value);
+    sql += " DEFAULT ";
+    serialize(context, sql, columnSpec.default_value);
   }
-
-  return ret;
 }
 
 template <typename TableSpec, typename... ColumnSpecs>
-[[nodiscard]] auto to_sql_create_columns_string(
-    sqlite3::context_t& context,
-    const std::tuple<column_t<TableSpec, ColumnSpecs>...>& t) {
-  struct {
-    bool first = true;
-    [[nodiscard]] auto to_string() -> std::string {
-      if (first) {
-        first = false;
-        return "";
-      } else {
-        return ", ";
-      }
-    }
-  } separator;
-
-  return (std ::string{} + ... +
-          (separator.to_string() +
-           to_sql_column_spec_string(context, TableSpec{}, ColumnSpecs{})));
+constexpr auto serialize_create_columns(
+    sqlite3::context_t& context, std::string& sql,
+    const std::tuple<column_t<TableSpec, ColumnSpecs>...>& t) -> void {
+  auto first = true;
+  ((sql += (first ? "" : ", "), first = false,
+    serialize_column_spec(context, sql, TableSpec{}, ColumnSpecs{})),
+   ...);
 }
 
 template <typename ColumnSpec>
@@ -93,33 +82,35 @@ template <typename ColumnSpec>
 }
 
 template <typename TableSpec>
-[[nodiscard]] auto to_sql_primary_key(::sqlpp::sqlite3::context_t& context,
-                                      const ::sqlpp::table_t<TableSpec>& t) {
+constexpr auto serialize_primary_key(::sqlpp::sqlite3::context_t& context,
+                                     std::string& sql,
+                                     const ::sqlpp::table_t<TableSpec>& t)
+    -> void {
   using _primary_key = typename TableSpec::primary_key;
   if constexpr (_primary_key::empty()) {
-    return "";
+    return;
   } else if constexpr (_primary_key::size() == 1 and
                        primary_key_has_auto_increment(_primary_key{})) {
-    return "";  // auto incremented primary keys need to be specified inline
+    return;  // auto incremented primary keys need to be specified inline
   } else {
-    return ", PRIMARY KEY (" +
-           type_vector_to_sql_name(context, _primary_key{}) + ")";
+    sql += ", PRIMARY KEY (";
+    serialize_names(context, sql, _primary_key{});
+    sql += ")";
   }
 }
 }  // namespace sqlpp::sqlite3::detail
 
 namespace sqlpp {
 template <typename Table, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    sqlite3::context_t& context,
-    const clause_base<create_table_t<Table>, Statement>& t) {
-  auto ret = std::string{"CREATE TABLE "} + to_sql_string(context, t._table);
-  ret += "(";
-  ret += ::sqlpp::sqlite3::detail::to_sql_create_columns_string(
-      context, column_tuple_of(t._table));
-  ret += ::sqlpp::sqlite3::detail::to_sql_primary_key(context, t._table);
-  ret += ")";
-
-  return ret;
+constexpr auto serialize(sqlite3::context_t& context, std::string& sql,
+                         const clause_base<create_table_t<Table>, Statement>& t)
+    -> void {
+  sql += "CREATE TABLE ";
+  serialize(context, sql, t._table);
+  sql += "(";
+  ::sqlpp::sqlite3::detail::serialize_create_columns(
+      context, sql, column_tuple_of(t._table));
+  ::sqlpp::sqlite3::detail::serialize_primary_key(context, sql, t._table);
+  sql += ")";
 }
 }  // namespace sqlpp
@@ -31,10 +31,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace sqlpp {
 template <typename Table, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    sqlite3::context_t& context,
-    const clause_base<truncate_t<Table>, Statement>& t) {
-  return "DELETE FROM " + to_sql_name(context, name_tag_of_t<Table>{});
+constexpr auto serialize(sqlite3::context_t& context, std::string& sql,
+                         const clause_base<truncate_t<Table>, Statement>& t)
+    -> void {
+  sql += "DELETE FROM ";
+  sql += to_sql_name(context, name_tag_of_t<Table>{});
+}
+
+template <typename Table, typename Statement>
+auto sql_length_estimate(const sqlite3::context_t& context,
+                         const clause_base<truncate_t<Table>, Statement>&)
+    -> std::size_t {
+  return sql_length("DELETE FROM ") +
+         to_sql_name(context, name_tag_of_t<Table>{}).size();
 }
 
 }  // namespace sqlpp
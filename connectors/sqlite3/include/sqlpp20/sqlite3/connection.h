@@ -26,21 +26,36 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/chunked_insert.h>
 #include <sqlpp20/clause/command.h>
 #include <sqlpp20/connection.h>
 #include <sqlpp20/exception.h>
 #include <sqlpp20/result.h>
+#include <sqlpp20/sqlite3/backup.h>
+#include <sqlpp20/sqlite3/blob.h>
+#include <sqlpp20/sqlite3/bulk_insert.h>
 #include <sqlpp20/sqlite3/clause.h>
 #include <sqlpp20/sqlite3/connection_config.h>
 #include <sqlpp20/sqlite3/context.h>
 #include <sqlpp20/sqlite3/default_value.h>
+#include <sqlpp20/sqlite3/function.h>
 #include <sqlpp20/sqlite3/parameter.h>
 #include <sqlpp20/sqlite3/prepared_statement.h>
 #include <sqlpp20/sqlite3/prepared_statement_result.h>
+#include <sqlpp20/sqlite3/range_table.h>
+#include <sqlpp20/sqlite3/statement_cache.h>
 #include <sqlpp20/statement.h>
+#include <sqlpp20/static_sql_string.h>
 
+#include <chrono>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
 namespace sqlpp::sqlite3 {
 template <typename Pool, ::sqlpp::debug Debug>
@@ -62,6 +77,25 @@ struct connection_cleanup_t {
 using unique_connection_ptr =
     std::unique_ptr<::sqlite3, detail::connection_cleanup_t>;
 
+// An idle connection of a pool, along with the statements cached and the
+// statistics collected for it, which stay with the handle across checkouts
+struct pooled_handle_t {
+  unique_connection_ptr handle;
+  // Declared after the handle, so that cached statements are finalized first
+  std::shared_ptr<statement_cache_t> statement_cache;
+  std::shared_ptr<statement_statistics_registry_t> statement_statistics;
+};
+
+// Results that outlive their connection refer to the original object, which
+// must not reach the next user of the handle. They see it expire instead.
+template <typename T>
+auto hand_over(std::shared_ptr<T>& shared) -> std::shared_ptr<T> {
+  if (not shared) return nullptr;
+  auto result = std::make_shared<T>(std::move(*shared));
+  shared.reset();
+  return result;
+}
+
 }  // namespace sqlpp::sqlite3::detail
 
 namespace sqlpp::sqlite3 {
@@ -74,6 +108,10 @@ class base_connection : public ::sqlpp::connection,
 
   detail::unique_connection_ptr _handle;
   bool _transaction_active = false;
+  bool _parameterize_literals = false;
+  // Declared after _handle, so that cached statements are finalized first
+  std::shared_ptr<statement_cache_t> _statement_cache;
+  std::shared_ptr<statement_statistics_registry_t> _statement_statistics;
 
   template <typename... Clauses>
   friend class ::sqlpp::statement;
@@ -83,11 +121,21 @@ class base_connection : public ::sqlpp::connection,
 
   friend Pool;
 
+  template <typename ResultType, typename ParameterVector, typename ResultRow>
+  friend class prepared_statement_t;
+
   base_connection(const connection_config_t& config,
-                  detail::unique_connection_ptr&& handle, Pool* connection_pool)
+                  detail::pooled_handle_t&& pooled, Pool* connection_pool)
       : _pool_base{connection_pool},
         _debug_base{config.debug},
-        _handle{std::move(handle)} {}
+        _handle{std::move(pooled.handle)},
+        _parameterize_literals{config.parameterize_literals},
+        _statement_cache{pooled.statement_cache
+                             ? std::move(pooled.statement_cache)
+                             : make_statement_cache(config)},
+        _statement_statistics{pooled.statement_statistics
+                                  ? std::move(pooled.statement_statistics)
+                                  : make_statement_statistics(config)} {}
 
   base_connection(const connection_config_t& config, Pool* connection_pool)
       : base_connection{config} {
@@ -95,9 +143,15 @@ class base_connection : public ::sqlpp::connection,
   }
 
  public:
+  using context_type = context_t;
+
   base_connection() = delete;
   base_connection(const connection_config_t& config)
-      : _debug_base{config.debug}, _handle{nullptr, {}} {
+      : _debug_base{config.debug},
+        _handle{nullptr, {}},
+        _parameterize_literals{config.parameterize_literals},
+        _statement_cache{make_statement_cache(config)},
+        _statement_statistics{make_statement_statistics(config)} {
     ::sqlite3* connection_ptr = nullptr;
     const auto rc = sqlite3_open_v2(
         config.path_to_database.c_str(), &connection_ptr, config.flags,
@@ -121,6 +175,10 @@ class base_connection : public ::sqlpp::connection,
     }
 #endif
 
+    if (not config.load_from.empty()) {
+      detail::load_database(_handle.get(), config.load_from);
+    }
+
     if (config.post_connect) {
       config.post_connect(_handle.get());
     }
@@ -131,17 +189,22 @@ class base_connection : public ::sqlpp::connection,
   base_connection& operator=(const base_connection&) = delete;
   base_connection& operator=(base_connection&&) = default;
   ~base_connection() {
+    // The handle might be in use elsewhere as soon as it is back in the pool
     if constexpr (not std::is_same_v<Pool, ::sqlpp::no_pool>) {
       if (this->_connection_pool)
-        this->_connection_pool->put(std::move(_handle));
+        this->_connection_pool->put(detail::pooled_handle_t{
+            std::move(_handle), detail::hand_over(_statement_cache),
+            detail::hand_over(_statement_statistics)});
     }
+    _statement_cache.reset();
   }
 
   auto operator()(const std::string& sql_string) {
     auto prepared_statement =
         prepared_statement_t<::sqlpp::execute_result, ::sqlpp::type_vector<>,
                              ::sqlpp::none_t>{
-            *this, sql_string, detail::result_owns_statement{true}};
+            *this, prepare_cached(sql_string),
+            detail::result_owns_statement{true}};
     prepared_statement.execute();
   }
 
@@ -185,6 +248,112 @@ class base_connection : public ::sqlpp::connection,
     }
   }
 
+  // Prepares a constexpr statement (with static storage duration) using SQL
+  // text that has been generated at compile time.
+  template <const auto& Statement>
+  auto prepare() {
+    using _statement_t = std::remove_cvref_t<decltype(Statement)>;
+    if constexpr (constexpr auto _check =
+                      check_statement_preparable<base_connection>(
+                          type_v<_statement_t>);
+                  _check) {
+      return ::sqlpp::sqlite3::prepared_statement_t<
+          result_type_of_t<_statement_t>, parameters_of_t<_statement_t>,
+          result_row_of_t<_statement_t>>{
+          *this,
+          std::string_view{::sqlpp::static_sql_string_v<context_t, Statement>},
+          detail::result_owns_statement{false}};
+    } else {
+      return ::sqlpp::bad_expression_t{_check};
+    }
+  }
+
+  // Inserts rows through a single prepared statement, committing every
+  // options.rows_per_transaction rows. Rows are tuples of assignments of plain
+  // values, e.g. `tab.name = std::string{}`, or are turned into such tuples
+  // by `projection`.
+  template <typename Table, typename Rows, typename Projection = std::identity>
+  auto bulk_insert(const Table& table, const Rows& rows,
+                   const bulk_insert_options_t& options = {},
+                   Projection projection = {}) -> bulk_insert_result_t {
+    using _row_t = std::remove_cvref_t<std::invoke_result_t<
+        Projection&, std::ranges::range_reference_t<const Rows>>>;
+    const auto start = std::chrono::steady_clock::now();
+    const auto owns_transactions = not _transaction_active;
+
+    auto relaxed_durability = std::optional<detail::relaxed_durability_t>{};
+    if (options.relax_durability and owns_transactions) {
+      relaxed_durability.emplace(get());
+    }
+
+    auto statement =
+        prepare_cached(detail::bulk_insert_sql(table, type_v<_row_t>));
+    auto result = bulk_insert_result_t{};
+    auto rows_in_transaction = std::size_t{0};
+    try {
+      for (const auto& row : rows) {
+        if (owns_transactions and rows_in_transaction == 0) {
+          start_transaction();
+        }
+        detail::bulk_insert_row(get(), statement.get(),
+                                std::invoke(projection, row));
+        ++result.rows;
+        if (owns_transactions and
+            ++rows_in_transaction == options.rows_per_transaction) {
+          commit();
+          rows_in_transaction = 0;
+        }
+      }
+      if (owns_transactions and rows_in_transaction > 0) {
+        commit();
+      }
+    } catch (...) {
+      if (owns_transactions and _transaction_active) {
+        destroy_transaction();
+      }
+      throw;
+    }
+
+    result.duration = std::chrono::steady_clock::now() - start;
+    return result;
+  }
+
+  // Makes `range` available to queries as `table`, without copying it. The
+  // table's columns are the values of `projection(element)`, a single value
+  // for tables with one column, a tuple otherwise. The range has to outlive
+  // the returned handle.
+  template <typename Table, std::ranges::forward_range Range,
+            typename Projection = std::identity>
+  [[nodiscard]] auto register_range_table(const Table& table,
+                                          const Range& range,
+                                          Projection projection = {})
+      -> range_table_t {
+    return detail::register_range_table(get(), table, range,
+                                        std::move(projection));
+  }
+  template <typename Table, std::ranges::forward_range Range,
+            typename Projection = std::identity>
+  auto register_range_table(const Table& table, const Range&& range,
+                            Projection projection = {})
+      -> range_table_t = delete;
+
+  // Implements a scalar function, e.g. for use in where(), by `callable`
+  template <typename NameTag, typename Signature, typename Callable>
+  auto register_function(const scalar_function_t<NameTag, Signature>& function,
+                         Callable callable) -> void {
+    detail::register_function(get(), function, std::move(callable));
+  }
+
+  // Implements an aggregate function by default constructed instances of
+  // `Accumulator`, one per group
+  template <typename Accumulator, typename NameTag, typename Signature>
+  auto register_aggregate(
+      const aggregate_function_t<NameTag, Signature>& function) -> void {
+    detail::register_aggregate<Accumulator>(get(), function);
+  }
+
+  auto is_transaction_active() const -> bool { return _transaction_active; }
+
   auto start_transaction() -> void {
     if (_transaction_active) {
       throw sqlpp::exception(
@@ -192,8 +361,8 @@ class base_connection : public ::sqlpp::connection,
     }
 
     auto prepared_statement =
-        prepared_statement_t{*this, ::sqlpp::command("BEGIN TRANSACTION"),
-                             detail::result_owns_statement{true}};
+        prepare_direct(::sqlpp::command("BEGIN TRANSACTION"),
+                       detail::result_owns_statement{true});
     prepared_statement.execute();
     _transaction_active = true;
   }
@@ -205,8 +374,8 @@ class base_connection : public ::sqlpp::connection,
     }
 
     _transaction_active = false;
-    auto prepared_statement = prepared_statement_t{
-        *this, ::sqlpp::command("COMMIT"), detail::result_owns_statement{true}};
+    auto prepared_statement = prepare_direct(
+        ::sqlpp::command("COMMIT"), detail::result_owns_statement{true});
     prepared_statement.execute();
   }
 
@@ -217,9 +386,8 @@ class base_connection : public ::sqlpp::connection,
     }
 
     _transaction_active = false;
-    auto prepared_statement =
-        prepared_statement_t{*this, ::sqlpp::command("ROLLBACK"),
-                             detail::result_owns_statement{true}};
+    auto prepared_statement = prepare_direct(
+        ::sqlpp::command("ROLLBACK"), detail::result_owns_statement{true});
     prepared_statement.execute();
   }
 
@@ -246,37 +414,163 @@ class base_connection : public ::sqlpp::connection,
 
   auto* get() const { return _handle.get(); }
 
+  // Sorted by total duration, longest first. Empty, unless
+  // collect_statement_statistics is set.
+  auto statement_statistics() const -> std::vector<statement_statistics_t> {
+    return _statement_statistics ? _statement_statistics->statistics()
+                                 : std::vector<statement_statistics_t>{};
+  }
+
+  auto reset_statement_statistics() -> void {
+    if (_statement_statistics) _statement_statistics->clear();
+  }
+
+  // Opens the value of a column in the row with `rowid` for incremental I/O,
+  // e.g. to stream a value that was inserted as zeroblob(size). The value
+  // keeps its size. Tables of attached databases are opened via `schema`.
+  template <typename Column>
+  [[nodiscard]] auto open_blob(const Column&, std::int64_t rowid,
+                               blob_mode mode = blob_mode::read_only,
+                               const std::string& schema = "main") const
+      -> blob_stream_t {
+    using _table_spec = table_spec_of_t<Column>;
+    return blob_stream_t{get(),
+                         schema,
+                         std::string{_table_spec::_sqlpp_name_tag::name},
+                         std::string{name_tag_of_t<Column>::name},
+                         rowid,
+                         mode};
+  }
+
+  // Writes a snapshot of the database to a file, e.g. to persist an
+  // in-memory database
+  auto save_to(const std::string& path) const -> void {
+    detail::save_database(get(), path);
+  }
+
+  // All zero, if the statement cache is disabled
+  auto statement_cache_statistics() const -> statement_cache_statistics_t {
+    return _statement_cache ? _statement_cache->statistics()
+                            : statement_cache_statistics_t{};
+  }
+
+  auto insert_chunk_limits() const -> insert_chunk_limits_t {
+    // A negative new value just queries the current limit
+    const auto max_length = sqlite3_limit(get(), SQLITE_LIMIT_SQL_LENGTH, -1);
+    const auto max_variables =
+        sqlite3_limit(get(), SQLITE_LIMIT_VARIABLE_NUMBER, -1);
+
+    auto limits = insert_chunk_limits_t{};
+    limits.max_sql_length = static_cast<std::size_t>(max_length) / 2;
+    if (_parameterize_literals) {
+      limits.max_parameters = static_cast<std::size_t>(max_variables);
+    }
+    return limits;
+  }
+
+  // Rows inserted, updated or deleted by the last such statement, not
+  // counting rows changed by triggers or skipped by conflict resolution
+  auto affected_rows() const -> std::uint64_t {
+    return static_cast<std::uint64_t>(sqlite3_changes(get()));
+  }
+
   auto is_alive() -> bool;
 
  private:
+  // Prepares a statement for direct execution. With parameterize_literals,
+  // literal values are bound to placeholders instead of being part of the SQL.
+  // Generic statements (e.g. DDL) keep their literals, as they do not accept
+  // placeholders everywhere.
+  template <typename Statement>
+  auto prepare_direct(const Statement& statement,
+                      detail::result_owns_statement ownership) {
+    using _result_t = result_type_of_t<Statement>;
+    using _prepared_statement_t =
+        prepared_statement_t<_result_t, parameters_of_t<Statement>,
+                             result_row_of_t<Statement>>;
+    if (std::is_same_v<_result_t, execute_result> or
+        not _parameterize_literals) {
+      return _prepared_statement_t{
+          *this,
+          prepare_cached(to_sql_string_cached(context_t{}, statement)),
+          ownership};
+    }
+
+    auto literals = literal_parameters_t{};
+    auto context = context_t{};
+    context.literal_parameters = &literals;
+    auto prepared_statement = _prepared_statement_t{
+        *this, prepare_cached(to_sql_string(context, statement)), ownership};
+    bind_literal_parameters(prepared_statement.get(), literals);
+    return prepared_statement;
+  }
+
+  // Cached statements are prepared for long term use and return to the cache
+  // when their prepared_statement_t or result is destroyed.
+  auto prepare_cached(std::string_view sql_string)
+      -> detail::unique_prepared_statement_ptr {
+    if (not _statement_cache) {
+      return detail::prepare_statement(get(), sql_string, 0);
+    }
+
+    auto* handle = _statement_cache->take(sql_string);
+    if (not handle) {
+      handle = detail::prepare_statement(get(), sql_string,
+                                         SQLITE_PREPARE_PERSISTENT)
+                   .release();
+    }
+    return detail::unique_prepared_statement_ptr{handle,
+                                                 {true, _statement_cache}};
+  }
+
+  static auto make_statement_statistics(const connection_config_t& config)
+      -> std::shared_ptr<statement_statistics_registry_t> {
+    if (not config.collect_statement_statistics) {
+      return nullptr;
+    }
+    return std::make_shared<statement_statistics_registry_t>();
+  }
+
+  static auto make_statement_cache(const connection_config_t& config)
+      -> std::shared_ptr<statement_cache_t> {
+    if (config.statement_cache_capacity == 0) {
+      return nullptr;
+    }
+    return std::make_shared<statement_cache_t>(config.statement_cache_capacity);
+  }
+
   template <typename... Clauses>
   auto execute(const ::sqlpp::statement<Clauses...>& statement) {
-    auto prepared_statement = prepare(statement);
+    auto prepared_statement =
+        prepare_direct(statement, detail::result_owns_statement{false});
     prepared_statement.execute();
   }
 
   template <typename Statement>
   auto insert(const Statement& statement) {
-    auto prepared_statement = prepare(statement);
+    auto prepared_statement =
+        prepare_direct(statement, detail::result_owns_statement{false});
     return prepared_statement.execute();
   }
 
   template <typename Statement>
   auto update(const Statement& statement) {
-    auto prepared_statement = prepare(statement);
+    auto prepared_statement =
+        prepare_direct(statement, detail::result_owns_statement{false});
     return prepared_statement.execute();
   }
 
   template <typename Statement>
   auto delete_from(const Statement& statement) {
-    auto prepared_statement = prepare(statement);
+    auto prepared_statement =
+        prepare_direct(statement, detail::result_owns_statement{false});
     return prepared_statement.execute();
   }
 
   template <typename Statement>
   [[nodiscard]] auto select(const Statement& statement) {
-    auto prepared_statement = ::sqlpp::sqlite3::prepared_statement_t{
-        *this, statement, detail::result_owns_statement{true}};
+    auto prepared_statement =
+        prepare_direct(statement, detail::result_owns_statement{true});
     return prepared_statement.execute();
   }
 };
@@ -32,6 +32,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlite3.h>
 #endif
 
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+
 namespace sqlpp::sqlite3 {
 struct connection_config_t {
   std::function<void(::sqlite3*)> post_connect;
@@ -40,6 +46,16 @@ struct connection_config_t {
   int flags = 0;
   std::string vfs;
   std::function<void(std::string_view)> debug;
+  // Directly executed statements bind their literal values as parameters
+  // instead of embedding them into the SQL text.
+  bool parameterize_literals = false;
+  // Number of idle prepared statements kept for direct execution (0: none)
+  std::size_t statement_cache_capacity = 0;
+  // Database file that is copied into the opened database, unless that has
+  // content already (see in_memory_config)
+  std::string load_from;
+  // Collects sqlite3_stmt_status counters and timings per SQL text
+  bool collect_statement_statistics = false;
 
   connection_config_t() = default;
   connection_config_t(const connection_config_t&) = default;
@@ -49,4 +65,18 @@ struct connection_config_t {
   ~connection_config_t() = default;
 };
 
+// Opens an in-memory database `name` instead of the configured file, and
+// loads the file into it with the first connection. Connections of the same
+// process share the in-memory database by name, as long as one of them is
+// open.
+inline auto in_memory_config(connection_config_t config,
+                             const std::string_view name)
+    -> connection_config_t {
+  config.load_from = std::move(config.path_to_database);
+  config.path_to_database = "file:/" + std::string(name) + "?vfs=memdb";
+  config.flags &= ~SQLITE_OPEN_READONLY;
+  config.flags |= SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_URI;
+  config.vfs.clear();
+  return config;
+}
 }  // namespace sqlpp::sqlite3
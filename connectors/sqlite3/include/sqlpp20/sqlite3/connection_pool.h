@@ -33,7 +33,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace sqlpp::sqlite3::detail {
 class circular_connection_buffer_t {
-  std::vector<detail::unique_connection_ptr> _data;
+  std::vector<detail::pooled_handle_t> _data;
   std::size_t _head = 0;
   std::size_t _tail = 0;
   std::size_t _size = 0;
@@ -57,7 +57,7 @@ class circular_connection_buffer_t {
     }
   }
 
-  auto push_back(detail::unique_connection_ptr t) {
+  auto push_back(detail::pooled_handle_t t) {
     if (_data.empty()) return;
     _data[_head] = std::move(t);
     if ((_head != _tail) or empty()) {
@@ -96,22 +96,23 @@ class connection_pool_t {
   [[nodiscard]] auto get() -> _connection_t {
     const auto lock = std::scoped_lock{_mutex};
 
-    auto handle = [this]() {
-      if (_handles.empty()) return detail::unique_connection_ptr{};
+    auto pooled = [this]() {
+      if (_handles.empty()) return detail::pooled_handle_t{};
 
-      auto handle = detail::unique_connection_ptr(std::move(_handles.front()));
+      auto pooled = std::move(_handles.front());
       _handles.pop_front();
-      return handle;
+      return pooled;
     }();
 
-    return handle ? _connection_t{_connection_config, std::move(handle), this}
-                  : _connection_t{_connection_config, this};
+    return pooled.handle
+               ? _connection_t{_connection_config, std::move(pooled), this}
+               : _connection_t{_connection_config, this};
   }
 
  private:
-  auto put(detail::unique_connection_ptr handle) -> void {
+  auto put(detail::pooled_handle_t pooled) -> void {
     const auto lock = std::scoped_lock{_mutex};
-    _handles.push_back(std::move(handle));
+    _handles.push_back(std::move(pooled));
   }
 };
 
@@ -27,9 +27,25 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/context_base.h>
+#include <sqlpp20/literal_parameters.h>
+#include <sqlpp20/to_sql_string.h>
+
+#include <string>
 
 namespace sqlpp::sqlite3 {
 struct context_t : public ::sqlpp::context_base {
   int parameter_index = 0;
+  // If set, literal values are collected here and replaced by placeholders
+  literal_parameters_t* literal_parameters = nullptr;
 };
 }  // namespace sqlpp::sqlite3
+
+namespace sqlpp {
+// Positional placeholder, used for parameters and lifted literals alike
+constexpr auto serialize_placeholder(sqlite3::context_t& context,
+                                     std::string& sql) -> void {
+  // pre-increment, because sqlite parameters start counting at 1
+  sql += "?";
+  detail::serialize_integral(sql, ++context.parameter_index);
+}
+}  // namespace sqlpp
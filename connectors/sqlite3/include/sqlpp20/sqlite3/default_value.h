@@ -31,9 +31,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace sqlpp {
 template <typename T = void>
-[[nodiscard]] auto to_sql_string(
-    [[maybe_unused]] ::sqlpp::sqlite3::context_t& context,
-    const ::sqlpp::default_value_t&) {
+constexpr auto serialize([[maybe_unused]] ::sqlpp::sqlite3::context_t& context,
+                         std::string& sql,
+                         const ::sqlpp::default_value_t&) -> void {
   static_assert(sqlpp::wrong<T>, "default_value cannot be used with sqlite3");
 }
 
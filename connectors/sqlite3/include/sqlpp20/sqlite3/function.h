@@ -0,0 +1,427 @@
+#pragma once
+
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/data_types.h>
+#include <sqlpp20/exception.h>
+#include <sqlpp20/operator/as.h>
+#include <sqlpp20/sqlite3/context.h>
+#include <sqlpp20/sqlite3/value_conversion.h>
+#include <sqlpp20/tuple_to_sql_string.h>
+#include <sqlpp20/type_traits.h>
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+namespace sqlpp::sqlite3::detail {
+// The value type of expressions that yield a C++ value of type T
+template <typename T>
+struct function_value_type {
+  using type = std::conditional_t<
+      std::is_same_v<T, bool>, bool,
+      std::conditional_t<std::is_integral_v<T>, std::int64_t,
+                         std::conditional_t<std::is_floating_point_v<T>,
+                                            double, ::sqlpp::text>>>;
+};
+
+template <typename T>
+struct function_value_type<std::optional<T>> {
+  using type = std::optional<typename function_value_type<T>::type>;
+};
+
+template <typename T>
+using function_value_type_t =
+    typename function_value_type<std::remove_cvref_t<T>>::type;
+
+template <typename Arg, typename Expr>
+constexpr auto is_function_argument() -> bool {
+  using _arg_t = remove_optional_t<Arg>;
+  if constexpr (std::is_same_v<_arg_t, bool>) {
+    return has_boolean_value_v<Expr>;
+  } else if constexpr (std::is_arithmetic_v<_arg_t>) {
+    return has_numeric_value_v<Expr>;
+  } else {
+    return has_text_value_v<Expr>;
+  }
+}
+
+template <typename Expr>
+constexpr auto can_be_null_argument() -> bool {
+  return is_optional_v<Expr> or is_optional_v<value_type_of_t<Expr>> or
+         can_be_null_v<Expr>;
+}
+
+// NULL is passed to optional parameters only. Other parameters make the
+// function yield NULL (scalar functions) or skip the row (aggregates).
+template <typename... Args, typename... Exprs>
+constexpr auto can_yield_null(type_vector<Args...>, type_vector<Exprs...>)
+    -> bool {
+  return (false or ... or
+          (not is_optional_v<Args> and can_be_null_argument<Exprs>()));
+}
+}  // namespace sqlpp::sqlite3::detail
+
+namespace sqlpp::sqlite3 {
+// A call of a function that has been registered with the connection
+template <typename Function, typename... Args>
+struct function_call_t {
+  std::tuple<Args...> _args;
+
+  template <typename Alias>
+  [[nodiscard]] constexpr auto as(const Alias& alias) const {
+    return ::sqlpp::as(*this, alias);
+  }
+};
+
+template <typename Function, typename... Args>
+constexpr auto serialize(context_t& context, std::string& sql,
+                         const function_call_t<Function, Args...>& t) -> void {
+  sql += Function::_sqlpp_name_tag::name;
+  sql += "(";
+  serialize_tuple(context, sql, ", ", t._args);
+  sql += ")";
+}
+
+template <typename Function, typename... Args>
+auto sql_length_estimate(const context_t& context,
+                         const function_call_t<Function, Args...>& t)
+    -> std::size_t {
+  return Function::_sqlpp_name_tag::name.size() + 1 +
+         sql_length_estimate_tuple(context, ", ", t._args) + 1;
+}
+
+template <typename NameTag, typename Result, typename... Args>
+struct function_spec_t {
+  using _sqlpp_name_tag = NameTag;
+  using _result_t = Result;
+  using _args_t = type_vector<Args...>;
+
+  template <typename... Exprs>
+  using _value_t = std::conditional_t<
+      detail::can_yield_null(_args_t{}, type_vector<Exprs...>{}),
+      add_optional_t<remove_optional_t<detail::function_value_type_t<Result>>>,
+      detail::function_value_type_t<Result>>;
+
+  template <typename... Exprs>
+  static constexpr auto _accepts() -> bool {
+    if constexpr (sizeof...(Exprs) != sizeof...(Args)) {
+      return false;
+    } else {
+      return (true and ... and detail::is_function_argument<Args, Exprs>());
+    }
+  }
+};
+
+// A scalar function implemented in C++, e.g.
+//
+//   SQLPP_CREATE_NAME_TAG(is_prime);
+//   constexpr auto isPrime = scalar_function<bool(std::int64_t)>(is_prime);
+//   db.register_function(isPrime, [](std::int64_t n) { return ...; });
+//   db(select(tab.id).from(tab).where(isPrime(tab.id)));
+template <typename NameTag, typename Signature>
+struct scalar_function_t;
+
+template <typename NameTag, typename Result, typename... Args>
+struct scalar_function_t<NameTag, Result(Args...)>
+    : public function_spec_t<NameTag, Result, Args...> {
+  template <typename... Exprs>
+  requires(scalar_function_t::template _accepts<Exprs...>())
+  [[nodiscard]] constexpr auto operator()(Exprs... exprs) const {
+    return function_call_t<scalar_function_t, Exprs...>{
+        std::tuple{exprs...}};
+  }
+};
+
+template <typename Signature, typename NameTag>
+[[nodiscard]] constexpr auto scalar_function(const NameTag&) {
+  return scalar_function_t<name_tag_of_t<NameTag>, Signature>{};
+}
+
+// An aggregate function implemented in C++ by an accumulator class, e.g.
+//
+//   struct median_t {
+//     std::vector<double> values;
+//     auto step(double value) -> void { values.push_back(value); }
+//     auto finalize() -> std::optional<double> { ... }
+//   };
+//   SQLPP_CREATE_NAME_TAG(median);
+//   constexpr auto medianOf = aggregate_function<double(double)>(median);
+//   db.register_aggregate<median_t>(medianOf);
+//
+// Accumulators that also provide `inverse(Args...)` and `value()` are
+// registered as window functions.
+template <typename NameTag, typename Signature>
+struct aggregate_function_t;
+
+template <typename NameTag, typename Result, typename... Args>
+struct aggregate_function_t<NameTag, Result(Args...)>
+    : public function_spec_t<NameTag, Result, Args...> {
+  template <typename... Exprs>
+  requires(aggregate_function_t::template _accepts<Exprs...>() and
+           (true and ... and not is_aggregate_v<Exprs>))
+  [[nodiscard]] constexpr auto operator()(Exprs... exprs) const {
+    return function_call_t<aggregate_function_t, Exprs...>{
+        std::tuple{exprs...}};
+  }
+};
+
+template <typename Signature, typename NameTag>
+[[nodiscard]] constexpr auto aggregate_function(const NameTag&) {
+  return aggregate_function_t<name_tag_of_t<NameTag>, Signature>{};
+}
+}  // namespace sqlpp::sqlite3
+
+namespace sqlpp {
+template <typename Function, typename... Args>
+struct nodes_of<::sqlpp::sqlite3::function_call_t<Function, Args...>> {
+  using type = type_vector<Args...>;
+};
+
+template <typename Function, typename... Args>
+struct value_type_of<::sqlpp::sqlite3::function_call_t<Function, Args...>> {
+  using type = typename Function::template _value_t<Args...>;
+};
+
+template <typename NameTag, typename Signature, typename... Args>
+constexpr auto is_aggregate_v<::sqlpp::sqlite3::function_call_t<
+    ::sqlpp::sqlite3::aggregate_function_t<NameTag, Signature>, Args...>> =
+    true;
+}  // namespace sqlpp
+
+namespace sqlpp::sqlite3::detail {
+template <typename Arg>
+auto is_acceptable_argument(::sqlite3_value* value) -> bool {
+  return is_optional_v<Arg> or sqlite3_value_type(value) != SQLITE_NULL;
+}
+
+template <typename... Args, std::size_t... Is>
+auto get_function_arguments(::sqlite3_value** values,
+                            std::index_sequence<Is...>)
+    -> std::optional<std::tuple<Args...>> {
+  if (not(true and ... and is_acceptable_argument<Args>(values[Is]))) {
+    return std::nullopt;
+  }
+  return std::tuple<Args...>{from_sqlite3_value<Args>::get(values[Is])...};
+}
+
+template <typename... Args>
+auto get_function_arguments(::sqlite3_value** values)
+    -> std::optional<std::tuple<Args...>> {
+  return get_function_arguments<Args...>(values,
+                                         std::index_sequence_for<Args...>{});
+}
+
+template <typename Result>
+auto set_function_result(::sqlite3_context* context, const Result& result)
+    -> void {
+  set_context_result(context, result, SQLITE_TRANSIENT);
+}
+
+inline auto set_function_error(::sqlite3_context* context) -> void {
+  try {
+    throw;
+  } catch (const std::bad_alloc&) {
+    sqlite3_result_error_nomem(context);
+  } catch (const std::exception& e) {
+    sqlite3_result_error(context, e.what(), -1);
+  } catch (...) {
+    sqlite3_result_error(context, "Sqlite3: Function failed", -1);
+  }
+}
+
+inline auto check_function_registration(::sqlite3* connection, int rc,
+                                        std::string_view name) -> void {
+  if (rc != SQLITE_OK) {
+    throw sqlpp::exception("Sqlite3: Could not register function " +
+                           std::string(name) + ": " +
+                           std::string(sqlite3_errmsg(connection)));
+  }
+}
+
+template <typename Callable, typename Result, typename... Args>
+struct scalar_function_adapter_t {
+  static auto call(::sqlite3_context* context, int, ::sqlite3_value** values)
+      -> void {
+    try {
+      auto& callable = *static_cast<Callable*>(sqlite3_user_data(context));
+      auto arguments = get_function_arguments<Args...>(values);
+      if (not arguments) {
+        sqlite3_result_null(context);
+        return;
+      }
+      set_function_result(context,
+                          static_cast<Result>(std::apply(callable,
+                                                         std::move(*arguments))));
+    } catch (...) {
+      set_function_error(context);
+    }
+  }
+
+  static auto destroy(void* callable) -> void {
+    delete static_cast<Callable*>(callable);
+  }
+};
+
+template <typename NameTag, typename Result, typename... Args,
+          typename Callable>
+auto register_function(::sqlite3* connection,
+                       const scalar_function_t<NameTag, Result(Args...)>&,
+                       Callable callable) -> void {
+  static_assert(std::is_invocable_v<Callable&, Args...>,
+                "the callable does not match the function's signature");
+  using _adapter_t = scalar_function_adapter_t<Callable, Result, Args...>;
+  auto* user_data = new Callable(std::move(callable));
+  // The user data is destroyed by sqlite3, even if registration fails
+  check_function_registration(
+      connection,
+      sqlite3_create_function_v2(connection, NameTag::name.data(),
+                                 sizeof...(Args),
+                                 SQLITE_UTF8 | SQLITE_DETERMINISTIC,
+                                 user_data, &_adapter_t::call, nullptr,
+                                 nullptr, &_adapter_t::destroy),
+      NameTag::name);
+}
+
+template <typename Accumulator, typename... Args>
+concept window_accumulator = requires(Accumulator& accumulator, Args... args) {
+  accumulator.inverse(args...);
+  accumulator.value();
+};
+
+// The aggregate context holds a pointer to the accumulator, which is created
+// with the first row of each group.
+template <typename Accumulator, typename Result, typename... Args>
+struct aggregate_function_adapter_t {
+  static auto get(::sqlite3_context* context, bool create) -> Accumulator* {
+    auto** accumulator = static_cast<Accumulator**>(
+        sqlite3_aggregate_context(context, create ? sizeof(Accumulator*) : 0));
+    if (not accumulator) {
+      if (create) throw std::bad_alloc{};
+      return nullptr;
+    }
+    if (not *accumulator and create) {
+      *accumulator = new Accumulator{};
+    }
+    return *accumulator;
+  }
+
+  static auto step(::sqlite3_context* context, int, ::sqlite3_value** values)
+      -> void {
+    try {
+      if (auto arguments = get_function_arguments<Args...>(values)) {
+        std::apply(
+            [&](auto&&... args) {
+              get(context, true)->step(std::forward<decltype(args)>(args)...);
+            },
+            std::move(*arguments));
+      }
+    } catch (...) {
+      set_function_error(context);
+    }
+  }
+
+  static auto inverse(::sqlite3_context* context, int,
+                      ::sqlite3_value** values) -> void {
+    try {
+      if (auto arguments = get_function_arguments<Args...>(values)) {
+        std::apply(
+            [&](auto&&... args) {
+              get(context, true)
+                  ->inverse(std::forward<decltype(args)>(args)...);
+            },
+            std::move(*arguments));
+      }
+    } catch (...) {
+      set_function_error(context);
+    }
+  }
+
+  static auto value(::sqlite3_context* context) -> void {
+    try {
+      auto* accumulator = get(context, true);
+      set_function_result(context, static_cast<Result>(accumulator->value()));
+    } catch (...) {
+      set_function_error(context);
+    }
+  }
+
+  // Groups without rows get a fresh accumulator
+  static auto final(::sqlite3_context* context) -> void {
+    auto accumulator = std::unique_ptr<Accumulator>(get(context, false));
+    try {
+      if (not accumulator) accumulator = std::make_unique<Accumulator>();
+      set_function_result(context,
+                          static_cast<Result>(accumulator->finalize()));
+    } catch (...) {
+      set_function_error(context);
+    }
+  }
+};
+
+template <typename Accumulator, typename NameTag, typename Result,
+          typename... Args>
+auto register_aggregate(::sqlite3* connection,
+                        const aggregate_function_t<NameTag, Result(Args...)>&)
+    -> void {
+  static_assert(std::is_default_constructible_v<Accumulator>,
+                "accumulators need to be default constructible");
+  using _adapter_t = aggregate_function_adapter_t<Accumulator, Result, Args...>;
+  constexpr auto flags = SQLITE_UTF8 | SQLITE_DETERMINISTIC;
+  if constexpr (window_accumulator<Accumulator, Args...>) {
+    check_function_registration(
+        connection,
+        sqlite3_create_window_function(
+            connection, NameTag::name.data(), sizeof...(Args), flags, nullptr,
+            &_adapter_t::step, &_adapter_t::final, &_adapter_t::value,
+            &_adapter_t::inverse, nullptr),
+        NameTag::name);
+  } else {
+    check_function_registration(
+        connection,
+        sqlite3_create_function_v2(connection, NameTag::name.data(),
+                                   sizeof...(Args), flags, nullptr, nullptr,
+                                   &_adapter_t::step, &_adapter_t::final,
+                                   nullptr),
+        NameTag::name);
+  }
+}
+}  // namespace sqlpp::sqlite3::detail
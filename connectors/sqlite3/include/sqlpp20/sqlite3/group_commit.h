@@ -0,0 +1,294 @@
+#pragma once
+
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/exception.h>
+#include <sqlpp20/sqlite3/connection.h>
+#include <sqlpp20/statement.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sqlpp::sqlite3 {
+struct group_commit_config_t {
+  // Statements per transaction
+  std::size_t max_batch_size = 256;
+  // How long the first statement of a batch waits for others to join it
+  std::chrono::microseconds window{1000};
+};
+
+struct group_commit_statistics_t {
+  std::size_t transactions = 0;
+  std::size_t statements = 0;
+  std::size_t failed_statements = 0;
+};
+}  // namespace sqlpp::sqlite3
+
+namespace sqlpp::sqlite3::detail {
+template <typename Connection>
+class group_commit_job_base_t {
+ public:
+  group_commit_job_base_t() = default;
+  group_commit_job_base_t(const group_commit_job_base_t&) = delete;
+  group_commit_job_base_t(group_commit_job_base_t&&) = delete;
+  group_commit_job_base_t& operator=(const group_commit_job_base_t&) = delete;
+  group_commit_job_base_t& operator=(group_commit_job_base_t&&) = delete;
+  virtual ~group_commit_job_base_t() = default;
+
+  virtual auto execute(Connection& connection) -> void = 0;
+  // Called once the transaction has been committed
+  virtual auto succeed() -> void = 0;
+  virtual auto fail(std::exception_ptr exception) -> void = 0;
+};
+
+template <typename Connection, typename Statement>
+class group_commit_job_t : public group_commit_job_base_t<Connection> {
+  using _result_t =
+      decltype(std::declval<Connection&>()(std::declval<const Statement&>()));
+
+  Statement _statement;
+  std::promise<_result_t> _promise;
+  std::optional<_result_t> _result;
+
+ public:
+  explicit group_commit_job_t(Statement statement)
+      : _statement(std::move(statement)) {}
+
+  [[nodiscard]] auto get_future() -> std::future<_result_t> {
+    return _promise.get_future();
+  }
+
+  auto execute(Connection& connection) -> void override {
+    if constexpr (std::is_void_v<_result_t>) {
+      connection(_statement);
+    } else {
+      _result.emplace(connection(_statement));
+    }
+  }
+
+  auto succeed() -> void override {
+    if constexpr (std::is_void_v<_result_t>) {
+      _promise.set_value();
+    } else {
+      _promise.set_value(std::move(*_result));
+    }
+  }
+
+  auto fail(std::exception_ptr exception) -> void override {
+    _promise.set_exception(std::move(exception));
+  }
+};
+}  // namespace sqlpp::sqlite3::detail
+
+namespace sqlpp::sqlite3 {
+// Executes statements submitted by any number of threads on a single
+// connection, in a background thread. Statements submitted within a short
+// window share one `BEGIN IMMEDIATE ... COMMIT`, and thus one sync to disk.
+//
+// Each statement runs within a savepoint of its own. If it fails, its
+// changes are rolled back and its future reports the error, while the other
+// statements of the batch are committed. Futures are fulfilled only after
+// the transaction has been committed.
+template <::sqlpp::debug Debug>
+class group_commit_writer_t {
+  using _connection_t = base_connection<::sqlpp::no_pool, Debug>;
+  using _job_t = detail::group_commit_job_base_t<_connection_t>;
+
+  group_commit_config_t _config;
+  _connection_t _connection;
+
+  mutable std::mutex _mutex;
+  std::condition_variable_any _condition;
+  std::vector<std::unique_ptr<_job_t>> _queue;
+  group_commit_statistics_t _statistics;
+
+  // Declared last, so that the thread is stopped before anything else goes
+  std::jthread _thread;
+
+  auto run(std::stop_token stop_token) -> void {
+    auto batch = std::vector<std::unique_ptr<_job_t>>{};
+    auto lock = std::unique_lock{_mutex};
+    while (true) {
+      _condition.wait(lock, stop_token, [this] { return not _queue.empty(); });
+      // Statements submitted before destruction are executed nonetheless
+      if (_queue.empty()) return;
+
+      if (not stop_token.stop_requested()) {
+        _condition.wait_for(lock, stop_token, _config.window, [this] {
+          return _queue.size() >= _config.max_batch_size;
+        });
+      }
+      const auto size = std::min(_queue.size(), _config.max_batch_size);
+      batch.assign(std::make_move_iterator(_queue.begin()),
+                   std::make_move_iterator(_queue.begin() + size));
+      _queue.erase(_queue.begin(), _queue.begin() + size);
+
+      lock.unlock();
+      const auto committed = execute(batch);
+      lock.lock();
+
+      ++_statistics.transactions;
+      _statistics.statements += size;
+      _statistics.failed_statements += size - committed.size();
+
+      // Statistics are up to date once futures become ready
+      lock.unlock();
+      for (auto* job : committed) job->succeed();
+      batch.clear();
+      lock.lock();
+    }
+  }
+
+  static auto normalized(group_commit_config_t config)
+      -> group_commit_config_t {
+    if (config.max_batch_size == 0) config.max_batch_size = 1;
+    return config;
+  }
+
+  // Returns the committed jobs, all others have failed already
+  auto execute(std::vector<std::unique_ptr<_job_t>>& batch)
+      -> std::vector<_job_t*> {
+    auto jobs = std::vector<_job_t*>{};
+    for (auto& job : batch) jobs.push_back(job.get());
+
+    // Some errors roll back the whole transaction (e.g. SQLITE_FULL or
+    // RAISE(ROLLBACK) in a trigger), taking the changes of the statements
+    // before them along. Those and the remaining statements are executed
+    // again in a new transaction. Each round fails at least one job.
+    while (true) {
+      try {
+        _connection("BEGIN IMMEDIATE");
+      } catch (...) {
+        for (auto* job : jobs) job->fail(std::current_exception());
+        return {};
+      }
+
+      auto succeeded = std::vector<_job_t*>{};
+      auto rolled_back = false;
+      for (auto it = jobs.begin(); it != jobs.end(); ++it) {
+        auto* job = *it;
+        try {
+          _connection("SAVEPOINT sqlpp_group_commit");
+        } catch (...) {
+          job->fail(std::current_exception());
+          continue;
+        }
+        try {
+          job->execute(_connection);
+          _connection("RELEASE sqlpp_group_commit");
+          succeeded.push_back(job);
+          continue;
+        } catch (...) {
+          job->fail(std::current_exception());
+        }
+        try {
+          _connection("ROLLBACK TO sqlpp_group_commit");
+          _connection("RELEASE sqlpp_group_commit");
+        } catch (...) {
+          // The savepoint is gone, if the transaction is
+        }
+        if (sqlite3_get_autocommit(_connection.get())) {
+          succeeded.insert(succeeded.end(), std::next(it), jobs.end());
+          jobs = std::move(succeeded);
+          rolled_back = true;
+          break;
+        }
+      }
+      if (rolled_back) {
+        if (jobs.empty()) return {};
+        continue;
+      }
+
+      try {
+        _connection("COMMIT");
+      } catch (...) {
+        if (not sqlite3_get_autocommit(_connection.get())) {
+          try {
+            _connection("ROLLBACK");
+          } catch (...) {
+          }
+        }
+        for (auto* job : succeeded) job->fail(std::current_exception());
+        return {};
+      }
+
+      return succeeded;
+    }
+  }
+
+ public:
+  group_commit_writer_t() = delete;
+  group_commit_writer_t(const connection_config_t& connection_config,
+                        group_commit_config_t config = {})
+      : _config(normalized(config)),
+        _connection(connection_config),
+        _thread([this](std::stop_token stop_token) { run(stop_token); }) {}
+  group_commit_writer_t(const group_commit_writer_t&) = delete;
+  group_commit_writer_t(group_commit_writer_t&&) = delete;
+  group_commit_writer_t& operator=(const group_commit_writer_t&) = delete;
+  group_commit_writer_t& operator=(group_commit_writer_t&&) = delete;
+  ~group_commit_writer_t() = default;
+
+  // The future holds the result of executing the statement on a connection,
+  // e.g. the id of an inserted row, once the transaction has been committed.
+  template <typename... Clauses>
+  [[nodiscard]] auto submit(::sqlpp::statement<Clauses...> statement) {
+    using _statement_t = ::sqlpp::statement<Clauses...>;
+    static_assert(
+        not std::is_same_v<result_type_of_t<_statement_t>, select_result>,
+        "group commit is for statements that modify the database");
+    auto job =
+        std::make_unique<detail::group_commit_job_t<_connection_t, _statement_t>>(
+            std::move(statement));
+    auto future = job->get_future();
+    {
+      const auto lock = std::scoped_lock{_mutex};
+      _queue.push_back(std::move(job));
+    }
+    _condition.notify_one();
+    return future;
+  }
+
+  [[nodiscard]] auto statistics() const -> group_commit_statistics_t {
+    const auto lock = std::scoped_lock{_mutex};
+    return _statistics;
+  }
+};
+}  // namespace sqlpp::sqlite3
@@ -31,10 +31,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 namespace sqlpp {
 template <typename ValueType, typename NameTag>
-[[nodiscard]] auto to_sql_string(sqlite3::context_t& context,
-                                 const parameter_t<ValueType, NameTag>&) {
-  // pre-increment, because sqlite parameters start counting at 1
-  return "?" + std::to_string(++context.parameter_index);
+constexpr auto serialize(sqlite3::context_t& context, std::string& sql,
+                         const parameter_t<ValueType, NameTag>&) -> void {
+  serialize_placeholder(context, sql);
+}
+
+// Exact for the first parameter, later ones may need another digit or two
+template <typename ValueType, typename NameTag>
+auto sql_length_estimate(const sqlite3::context_t& context,
+                         const parameter_t<ValueType, NameTag>&)
+    -> std::size_t {
+  return 1 + sql_length_estimate(context, context.parameter_index + 1);
 }
 
 }  // namespace sqlpp
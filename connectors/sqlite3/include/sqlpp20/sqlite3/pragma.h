@@ -0,0 +1,63 @@
+#pragma once
+
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/exception.h>
+
+#include <string>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+namespace sqlpp::sqlite3::detail {
+// Returns the first column of the first row (if any)
+inline auto execute_pragma(::sqlite3* connection, const std::string& sql)
+    -> std::string {
+  ::sqlite3_stmt* statement = nullptr;
+  if (sqlite3_prepare_v2(connection, sql.c_str(), -1, &statement, nullptr) !=
+      SQLITE_OK) {
+    throw sqlpp::exception("Sqlite3: Could not prepare " + sql + ": " +
+                           std::string(sqlite3_errmsg(connection)));
+  }
+  auto value = std::string{};
+  const auto rc = sqlite3_step(statement);
+  if (rc == SQLITE_ROW) {
+    if (const auto* text = sqlite3_column_text(statement, 0)) {
+      value = reinterpret_cast<const char*>(text);
+    }
+  }
+  sqlite3_finalize(statement);
+  if (rc != SQLITE_ROW and rc != SQLITE_DONE) {
+    throw sqlpp::exception("Sqlite3: Could not execute " + sql + ": " +
+                           std::string(sqlite3_errstr(rc)));
+  }
+  return value;
+}
+}  // namespace sqlpp::sqlite3::detail
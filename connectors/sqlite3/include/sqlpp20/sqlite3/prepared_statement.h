@@ -26,10 +26,15 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
 
 #ifdef SQLPP_USE_SQLCIPHER
 #include <sqlcipher/sqlite3.h>
@@ -37,10 +42,33 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlite3.h>
 #endif
 
+#include <sqlpp20/literal_parameters.h>
 #include <sqlpp20/prepared_statement_parameters.h>
+#include <sqlpp20/sql_string_cache.h>
 #include <sqlpp20/sqlite3/prepared_statement_result.h>
 
 namespace sqlpp::sqlite3::detail {
+inline auto prepare_statement(::sqlite3* connection,
+                              const std::string_view& sql_string,
+                              unsigned int flags)
+    -> unique_prepared_statement_ptr {
+  ::sqlite3_stmt* statement_ptr = nullptr;
+
+  const auto rc = sqlite3_prepare_v3(connection, sql_string.data(),
+                                     static_cast<int>(sql_string.size()),
+                                     flags, &statement_ptr, nullptr);
+
+  auto statement = unique_prepared_statement_ptr(statement_ptr, {true});
+
+  if (rc != SQLITE_OK) {
+    throw sqlpp::exception("Sqlite3: Could not prepare statement: " +
+                           std::string(sqlite3_errmsg(connection)) +
+                           " (statement was >>" + std::string(sql_string) +
+                           "<<)\n");
+  }
+  return statement;
+}
+
 inline void check_bind_result(int result, const char* const type) {
   switch (result) {
     case SQLITE_OK:
@@ -114,6 +142,24 @@ inline auto bind_parameter(::sqlite3_stmt* statement, std::string_view& value,
   detail::check_bind_result(result, "string_view");
 }
 
+inline auto bind_parameter(::sqlite3_stmt* statement,
+                           std::span<const std::uint8_t>& value, int index)
+    -> void {
+  const auto result =
+      sqlite3_bind_blob(statement, index, value.data(),
+                        static_cast<int>(value.size()), SQLITE_STATIC);
+  detail::check_bind_result(result, "blob");
+}
+
+inline auto bind_parameter(::sqlite3_stmt* statement,
+                           std::vector<std::uint8_t>& value, int index)
+    -> void {
+  const auto result =
+      sqlite3_bind_blob(statement, index, value.data(),
+                        static_cast<int>(value.size()), SQLITE_STATIC);
+  detail::check_bind_result(result, "blob");
+}
+
 template <typename T>
 auto bind_parameter(::sqlite3_stmt* statement, std::optional<T>& value,
                     int index) -> void {
@@ -133,11 +179,36 @@ auto bind_parameters(
                   ++index));
 }
 
+inline auto bind_literal_parameters(::sqlite3_stmt* statement,
+                                    const literal_parameters_t& literals)
+    -> void {
+  int index = 0;
+  for (const auto& literal : literals) {
+    ++index;
+    std::visit(
+        [&](const auto& value) {
+          if constexpr (std::is_same_v<std::decay_t<decltype(value)>,
+                                       std::string>) {
+            // The literals may be gone before the statement is stepped
+            const auto result = sqlite3_bind_text(
+                statement, index, value.data(), static_cast<int>(value.size()),
+                SQLITE_TRANSIENT);
+            detail::check_bind_result(result, "string");
+          } else {
+            auto copy = value;
+            bind_parameter(statement, copy, index);
+          }
+        },
+        literal);
+  }
+}
+
 template <typename ResultType, typename ParameterVector, typename ResultRow>
 class prepared_statement_t {
   detail::unique_prepared_statement_ptr _handle;
   detail::result_owns_statement _ownership;
   ::sqlite3* _connection;
+  std::shared_ptr<statement_statistics_registry_t> _statistics;
 
  public:
   ::sqlpp::prepared_statement_parameters<ParameterVector> parameters = {};
@@ -146,29 +217,35 @@ class prepared_statement_t {
 
   template <typename Connection>
   prepared_statement_t(const Connection& connection,
-                       const std::string& sql_string,
+                       detail::unique_prepared_statement_ptr handle,
                        detail::result_owns_statement ownership)
-      : _ownership(ownership), _connection(connection.get()) {
-    ::sqlite3_stmt* statement_ptr = nullptr;
+      : _handle(std::move(handle)),
+        _ownership(ownership),
+        _connection(connection.get()),
+        _statistics(connection._statement_statistics) {}
 
-    const auto rc = sqlite3_prepare_v2(connection.get(), sql_string.c_str(),
-                                       static_cast<int>(sql_string.size()),
-                                       &statement_ptr, nullptr);
-
-    _handle = detail::unique_prepared_statement_ptr(statement_ptr, {true});
+  template <typename Connection>
+  prepared_statement_t(const Connection& connection,
+                       const std::string_view& sql_string,
+                       detail::result_owns_statement ownership)
+      : prepared_statement_t{
+            connection,
+            detail::prepare_statement(connection.get(), sql_string, 0),
+            ownership} {}
 
-    if (rc != SQLITE_OK) {
-      throw sqlpp::exception("Sqlite3: Could not prepare statement: " +
-                             std::string(sqlite3_errmsg(connection.get())) +
-                             " (statement was >>" + sql_string + "<<)\n");
-    }
-  }
+  template <typename Connection>
+  prepared_statement_t(const Connection& connection,
+                       const std::string& sql_string,
+                       detail::result_owns_statement ownership)
+      : prepared_statement_t{connection, std::string_view{sql_string},
+                             ownership} {}
 
   template <typename Connection, typename Statement>
   prepared_statement_t(const Connection& connection, const Statement& statement,
                        detail::result_owns_statement ownership)
-      : prepared_statement_t{
-            connection, to_sql_string_c(context_t{}, statement), ownership} {}
+      : prepared_statement_t{connection,
+                             to_sql_string_cached(context_t{}, statement),
+                             ownership} {}
 
   prepared_statement_t(const prepared_statement_t&) = delete;
   prepared_statement_t(prepared_statement_t&& rhs) = default;
@@ -177,6 +254,8 @@ class prepared_statement_t {
   ~prepared_statement_t() = default;
 
   auto execute() {
+    const auto start = _statistics ? std::chrono::steady_clock::now()
+                                   : std::chrono::steady_clock::time_point{};
     if (const auto rc = sqlite3_reset(_handle.get()); rc != SQLITE_OK) {
       throw sqlpp::exception("Sqlite3: Could not reset statement: " +
                              std::string(sqlite3_errmsg(_connection)));
@@ -196,6 +275,10 @@ class prepared_statement_t {
           throw sqlpp::exception("Sqlite3: Could not execute statement: " +
                                  std::string(sqlite3_errstr(rc)));
       }
+      if (_statistics) {
+        _statistics->record(_handle.get(),
+                            std::chrono::steady_clock::now() - start);
+      }
     }
 
     if constexpr (std::is_same_v<ResultType, insert_result>) {
@@ -205,10 +288,14 @@ class prepared_statement_t {
     } else if constexpr (std::is_same_v<ResultType, update_result>) {
       return sqlite3_changes(_connection);
     } else if constexpr (std::is_same_v<ResultType, select_result>) {
-      return ::sqlpp::result_t<prepared_statement_result_t<ResultRow>>{
+      auto handle =
           (_ownership == (detail::result_owns_statement{true}))
-              ? detail::unique_prepared_statement_ptr{_handle.release(), {true}}
-              : detail::unique_prepared_statement_ptr{_handle.get(), {false}}};
+              ? std::move(_handle)
+              : detail::unique_prepared_statement_ptr{_handle.get(), {false}};
+      handle.get_deleter()._statistics = _statistics;
+      handle.get_deleter()._start = start;
+      return ::sqlpp::result_t<prepared_statement_result_t<ResultRow>>{
+          std::move(handle)};
     } else if constexpr (std::is_same_v<ResultType, execute_result>) {
       return sqlite3_changes(_connection);
     } else {
@@ -26,9 +26,11 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string_view>
 
 #ifdef SQLPP_USE_SQLCIPHER
@@ -38,16 +40,32 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 #include <sqlpp20/result_row.h>
+#include <sqlpp20/sqlite3/statement_cache.h>
+#include <sqlpp20/sqlite3/statement_statistics.h>
 
 namespace sqlpp::sqlite3::detail {
 enum class result_owns_statement : bool {};
 
 struct prepared_statement_cleanup_t {
   bool _owning;
+  // Owned statements are handed back to the cache they came from, if any
+  std::weak_ptr<statement_cache_t> _cache = {};
+  // Results record their statement's execution when they are done with it
+  std::weak_ptr<statement_statistics_registry_t> _statistics = {};
+  std::chrono::steady_clock::time_point _start = {};
 
   auto operator()(::sqlite3_stmt* handle) const noexcept -> void {
+    if (handle) {
+      if (const auto statistics = _statistics.lock()) {
+        statistics->record(handle, std::chrono::steady_clock::now() - _start);
+      }
+    }
     if (_owning and handle) {
-      sqlite3_finalize(handle);
+      if (const auto cache = _cache.lock()) {
+        cache->put(handle);
+      } else {
+        sqlite3_finalize(handle);
+      }
     }
   }
 };
@@ -101,6 +119,16 @@ inline auto assign_field(sqlite3_stmt* stmt, std::string_view& value, int index)
       static_cast<std::size_t>(sqlite3_column_bytes(stmt, index))};
 }
 
+inline auto assign_field(sqlite3_stmt* stmt,
+                         std::span<const std::uint8_t>& value, int index)
+    -> void {
+  // The pointer is only valid until the next step of the statement
+  const auto* data =
+      static_cast<const std::uint8_t*>(sqlite3_column_blob(stmt, index));
+  value = std::span<const std::uint8_t>{
+      data, static_cast<std::size_t>(sqlite3_column_bytes(stmt, index))};
+}
+
 template <typename T>
 auto assign_field(sqlite3_stmt* stmt, std::optional<T>& value, int index)
     -> void {
@@ -0,0 +1,306 @@
+#pragma once
+
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/exception.h>
+#include <sqlpp20/sqlite3/value_conversion.h>
+#include <sqlpp20/table.h>
+#include <sqlpp20/type_vector.h>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+namespace sqlpp::sqlite3 {
+// Keeps a range registered as a table with a connection (see
+// base_connection::register_range_table). Statements that use the table have
+// to be finished before the handle is destroyed.
+class range_table_t {
+  ::sqlite3* _connection = nullptr;
+  std::string _name;
+
+ public:
+  range_table_t(::sqlite3* connection, std::string name)
+      : _connection(connection), _name(std::move(name)) {}
+  range_table_t(const range_table_t&) = delete;
+  range_table_t(range_table_t&& rhs) noexcept
+      : _connection(std::exchange(rhs._connection, nullptr)),
+        _name(std::move(rhs._name)) {}
+  range_table_t& operator=(const range_table_t&) = delete;
+  range_table_t& operator=(range_table_t&& rhs) noexcept {
+    if (this != &rhs) {
+      reset();
+      _connection = std::exchange(rhs._connection, nullptr);
+      _name = std::move(rhs._name);
+    }
+    return *this;
+  }
+  ~range_table_t() { reset(); }
+
+  // Unregisters the table
+  auto reset() -> void {
+    if (_connection) {
+      sqlite3_create_module_v2(_connection, _name.c_str(), nullptr, nullptr,
+                               nullptr);
+      _connection = nullptr;
+    }
+  }
+};
+}  // namespace sqlpp::sqlite3
+
+namespace sqlpp::sqlite3::detail {
+// Values that are neither references nor views are temporaries of the
+// projection and need to be copied by sqlite3
+template <typename Value>
+constexpr auto range_table_text_is_static() -> bool {
+  using _value_t = std::remove_cvref_t<Value>;
+  return std::is_reference_v<Value> or
+         std::is_same_v<_value_t, std::string_view> or
+         std::is_same_v<_value_t, std::optional<std::string_view>> or
+         std::is_same_v<std::decay_t<_value_t>, const char*>;
+}
+
+template <typename ColumnSpecs>
+struct range_table_columns;
+
+template <typename... ColumnSpecs>
+struct range_table_columns<::sqlpp::type_vector<ColumnSpecs...>> {
+  static constexpr auto size = sizeof...(ColumnSpecs);
+
+  static auto declaration() -> std::string {
+    auto sql = std::string{"CREATE TABLE x("};
+    auto separator = std::string_view{};
+    ((sql += separator, sql += ColumnSpecs::_sqlpp_name_tag::name,
+      separator = ", "),
+     ...);
+    sql += ")";
+    return sql;
+  }
+};
+
+// An eponymous-only virtual table module: the module itself is the table,
+// there is no CREATE VIRTUAL TABLE.
+template <typename Columns, typename Range, typename Projection>
+class range_table_module_t {
+  using _iterator_t = std::ranges::iterator_t<const Range>;
+  using _projected_t =
+      std::invoke_result_t<const Projection&,
+                           std::ranges::range_reference_t<const Range>>;
+
+  struct vtab_t : public ::sqlite3_vtab {
+    range_table_module_t* module = nullptr;
+  };
+
+  struct cursor_t : public ::sqlite3_vtab_cursor {
+    std::optional<_iterator_t> iterator;
+    sqlite3_int64 row = 0;
+  };
+
+  const Range* _range;
+  Projection _projection;
+
+  template <std::size_t Index>
+  auto set_result(::sqlite3_context* context,
+                  const std::remove_reference_t<_projected_t>& values) const
+      -> void {
+    if constexpr (Columns::size == 1) {
+      constexpr auto is_static = std::is_lvalue_reference_v<_projected_t> or
+                                 range_table_text_is_static<_projected_t>();
+      set_context_result(context, values,
+                             is_static ? SQLITE_STATIC : SQLITE_TRANSIENT);
+    } else {
+      using _tuple_t = std::remove_cvref_t<_projected_t>;
+      constexpr auto is_static =
+          std::is_lvalue_reference_v<_projected_t> or
+          range_table_text_is_static<std::tuple_element_t<Index, _tuple_t>>();
+      set_context_result(context, std::get<Index>(values),
+                             is_static ? SQLITE_STATIC : SQLITE_TRANSIENT);
+    }
+  }
+
+  template <std::size_t... Indexes>
+  auto set_column(::sqlite3_context* context, const cursor_t& cursor,
+                  int index, std::index_sequence<Indexes...>) const -> void {
+    const auto& values = std::invoke(_projection, **cursor.iterator);
+    ((static_cast<int>(Indexes) == index
+          ? set_result<Indexes>(context, values)
+          : void()),
+     ...);
+  }
+
+  static auto connect(::sqlite3* connection, void* module, int,
+                      const char* const*, ::sqlite3_vtab** table, char**)
+      -> int {
+    const auto rc =
+        sqlite3_declare_vtab(connection, Columns::declaration().c_str());
+    if (rc != SQLITE_OK) return rc;
+    auto* new_table = new (std::nothrow) vtab_t{};
+    if (not new_table) return SQLITE_NOMEM;
+    new_table->module = static_cast<range_table_module_t*>(module);
+    *table = new_table;
+    return SQLITE_OK;
+  }
+
+  static auto disconnect(::sqlite3_vtab* table) -> int {
+    delete static_cast<vtab_t*>(table);
+    return SQLITE_OK;
+  }
+
+  // Full scans only. The row estimate lets the query planner decide on the
+  // order of joins.
+  static auto best_index(::sqlite3_vtab* table, ::sqlite3_index_info* info)
+      -> int {
+    if constexpr (std::ranges::sized_range<const Range>) {
+      const auto& range = *static_cast<vtab_t*>(table)->module->_range;
+      const auto rows = static_cast<sqlite3_int64>(std::ranges::size(range));
+      info->estimatedRows = rows;
+      info->estimatedCost = static_cast<double>(rows);
+    }
+    return SQLITE_OK;
+  }
+
+  static auto open(::sqlite3_vtab*, ::sqlite3_vtab_cursor** cursor) -> int {
+    auto* new_cursor = new (std::nothrow) cursor_t{};
+    if (not new_cursor) return SQLITE_NOMEM;
+    *cursor = new_cursor;
+    return SQLITE_OK;
+  }
+
+  static auto close(::sqlite3_vtab_cursor* cursor) -> int {
+    delete static_cast<cursor_t*>(cursor);
+    return SQLITE_OK;
+  }
+
+  static auto filter(::sqlite3_vtab_cursor* cursor, int, const char*, int,
+                     ::sqlite3_value**) -> int {
+    auto& range_cursor = *static_cast<cursor_t*>(cursor);
+    const auto& range =
+        *static_cast<vtab_t*>(cursor->pVtab)->module->_range;
+    range_cursor.iterator.emplace(std::ranges::begin(range));
+    range_cursor.row = 0;
+    return SQLITE_OK;
+  }
+
+  static auto next(::sqlite3_vtab_cursor* cursor) -> int {
+    auto& range_cursor = *static_cast<cursor_t*>(cursor);
+    ++*range_cursor.iterator;
+    ++range_cursor.row;
+    return SQLITE_OK;
+  }
+
+  static auto eof(::sqlite3_vtab_cursor* cursor) -> int {
+    const auto& range_cursor = *static_cast<cursor_t*>(cursor);
+    const auto& range =
+        *static_cast<vtab_t*>(cursor->pVtab)->module->_range;
+    return *range_cursor.iterator == std::ranges::end(range);
+  }
+
+  static auto column(::sqlite3_vtab_cursor* cursor, ::sqlite3_context* context,
+                     int index) -> int {
+    try {
+      static_cast<vtab_t*>(cursor->pVtab)
+          ->module->set_column(context, *static_cast<cursor_t*>(cursor), index,
+                           std::make_index_sequence<Columns::size>{});
+    } catch (const std::exception& e) {
+      sqlite3_result_error(context, e.what(), -1);
+    } catch (...) {
+      sqlite3_result_error(context, "Sqlite3: Range table projection failed",
+                           -1);
+    }
+    return SQLITE_OK;
+  }
+
+  static auto rowid(::sqlite3_vtab_cursor* cursor, sqlite_int64* row) -> int {
+    *row = static_cast<cursor_t*>(cursor)->row;
+    return SQLITE_OK;
+  }
+
+  static auto destroy(void* module) -> void {
+    delete static_cast<range_table_module_t*>(module);
+  }
+
+ public:
+  range_table_module_t(const Range& range, Projection projection)
+      : _range(&range), _projection(std::move(projection)) {}
+
+  static constexpr auto module = ::sqlite3_module{
+      .iVersion = 0,
+      .xCreate = nullptr,
+      .xConnect = &connect,
+      .xBestIndex = &best_index,
+      .xDisconnect = &disconnect,
+      .xDestroy = &disconnect,
+      .xOpen = &open,
+      .xClose = &close,
+      .xFilter = &filter,
+      .xNext = &next,
+      .xEof = &eof,
+      .xColumn = &column,
+      .xRowid = &rowid,
+  };
+
+  static auto register_with(::sqlite3* connection, std::string_view name,
+                            const Range& range, Projection projection)
+      -> range_table_t {
+    auto name_string = std::string{name};
+    auto* module = new range_table_module_t{range, std::move(projection)};
+    // The module is destroyed by sqlite3, even if registration fails
+    if (const auto rc = sqlite3_create_module_v2(
+            connection, name_string.c_str(), &range_table_module_t::module,
+            module, &destroy);
+        rc != SQLITE_OK) {
+      throw sqlpp::exception("Sqlite3: Could not register range table " +
+                             name_string + ": " +
+                             std::string(sqlite3_errmsg(connection)));
+    }
+    return range_table_t{connection, std::move(name_string)};
+  }
+};
+
+template <typename TableSpec, typename Range, typename Projection>
+auto register_range_table(::sqlite3* connection, const table_t<TableSpec>&,
+                          const Range& range, Projection projection)
+    -> range_table_t {
+  using _columns_t = range_table_columns<typename TableSpec::_columns>;
+  return range_table_module_t<_columns_t, Range, Projection>::register_with(
+      connection, TableSpec::_sqlpp_name_tag::name, range,
+      std::move(projection));
+}
+}  // namespace sqlpp::sqlite3::detail
@@ -0,0 +1,140 @@
+#pragma once
+
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+namespace sqlpp::sqlite3 {
+struct statement_cache_statistics_t {
+  std::size_t hits = 0;
+  std::size_t misses = 0;
+  std::size_t size = 0;
+};
+
+// Bounded LRU cache of prepared statements of one connection, keyed by their
+// SQL text. Statements are taken out of the cache while they are in use and
+// put back (reset) when their owner is done with them.
+class statement_cache_t {
+  struct statement_cleanup_t {
+    auto operator()(::sqlite3_stmt* handle) const noexcept -> void {
+      sqlite3_finalize(handle);
+    }
+  };
+  using _statement_ptr = std::unique_ptr<::sqlite3_stmt, statement_cleanup_t>;
+
+  struct entry_t {
+    std::string sql;
+    _statement_ptr statement;
+  };
+
+  std::size_t _capacity;
+  // most recently used first
+  std::list<entry_t> _entries;
+  std::unordered_map<std::string_view, std::list<entry_t>::iterator> _index;
+  std::size_t _hits = 0;
+  std::size_t _misses = 0;
+
+ public:
+  explicit statement_cache_t(std::size_t capacity) : _capacity(capacity) {}
+  statement_cache_t(const statement_cache_t&) = delete;
+  // Entries are list nodes, which keep their place, and with it the keys of
+  // the index
+  statement_cache_t(statement_cache_t&& rhs) noexcept
+      : _capacity(rhs._capacity),
+        _entries(std::move(rhs._entries)),
+        _index(std::move(rhs._index)),
+        _hits(rhs._hits),
+        _misses(rhs._misses) {
+    rhs.clear();
+  }
+  statement_cache_t& operator=(const statement_cache_t&) = delete;
+  statement_cache_t& operator=(statement_cache_t&&) = delete;
+  ~statement_cache_t() = default;
+
+  // Returns nullptr if there is no idle statement for `sql`
+  [[nodiscard]] auto take(std::string_view sql) -> ::sqlite3_stmt* {
+    const auto it = _index.find(sql);
+    if (it == _index.end()) {
+      ++_misses;
+      return nullptr;
+    }
+    ++_hits;
+    auto* statement = it->second->statement.release();
+    _entries.erase(it->second);
+    _index.erase(it);
+    return statement;
+  }
+
+  // Resets the statement and keeps it for the next take() with the same SQL
+  auto put(::sqlite3_stmt* handle) noexcept -> void {
+    auto statement = _statement_ptr{handle};
+    sqlite3_reset(handle);
+    sqlite3_clear_bindings(handle);
+
+    const auto* sql = sqlite3_sql(handle);
+    if (_capacity == 0 or sql == nullptr or _index.contains(sql)) {
+      return;
+    }
+
+    try {
+      _entries.push_front({std::string{sql}, std::move(statement)});
+      _index.emplace(_entries.front().sql, _entries.begin());
+    } catch (...) {
+      // Dropping the statement is fine
+      if (not _entries.empty() and _entries.front().statement.get() == handle) {
+        _entries.pop_front();
+      }
+      return;
+    }
+
+    if (_entries.size() > _capacity) {
+      _index.erase(_entries.back().sql);
+      _entries.pop_back();
+    }
+  }
+
+  auto statistics() const -> statement_cache_statistics_t {
+    return {_hits, _misses, _entries.size()};
+  }
+
+  auto clear() -> void {
+    _index.clear();
+    _entries.clear();
+  }
+};
+}  // namespace sqlpp::sqlite3
@@ -0,0 +1,135 @@
+#pragma once
+
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+namespace sqlpp::sqlite3 {
+// Aggregated over all executions of one SQL text (see sqlite3_stmt_status)
+struct statement_statistics_t {
+  std::string sql;
+  std::size_t executions = 0;
+  // Selects are timed until their last row has been read
+  std::chrono::steady_clock::duration total_duration = {};
+  std::chrono::steady_clock::duration max_duration = {};
+  // Rows visited by full table scans, a hint for missing indexes
+  std::int64_t fullscan_steps = 0;
+  std::int64_t sorts = 0;
+  // Indexes sqlite3 created on the fly, another hint for missing indexes
+  std::int64_t autoindexes = 0;
+  std::int64_t vm_steps = 0;
+  std::int64_t reprepares = 0;
+  // Largest memory use of a prepared statement for the SQL text
+  std::int64_t max_memory_used = 0;
+};
+
+// Statistics of statements executed by one connection, keyed by SQL text
+class statement_statistics_registry_t {
+  // Ordered for lookups by string_view, which do not allocate
+  std::map<std::string, statement_statistics_t, std::less<>> _statistics;
+
+  static auto take_counter(::sqlite3_stmt* statement, int counter)
+      -> std::int64_t {
+    return sqlite3_stmt_status(statement, counter, 1);
+  }
+
+ public:
+  statement_statistics_registry_t() = default;
+  statement_statistics_registry_t(const statement_statistics_registry_t&) =
+      delete;
+  statement_statistics_registry_t(statement_statistics_registry_t&&) = default;
+  statement_statistics_registry_t& operator=(
+      const statement_statistics_registry_t&) = delete;
+  statement_statistics_registry_t& operator=(
+      statement_statistics_registry_t&&) = delete;
+  ~statement_statistics_registry_t() = default;
+
+  // Counters of the statement are reset, so that they cover one execution
+  auto record(::sqlite3_stmt* statement,
+              std::chrono::steady_clock::duration duration) noexcept -> void {
+    const auto* sql = sqlite3_sql(statement);
+    if (sql == nullptr) return;
+
+    try {
+      const auto sql_view = std::string_view{sql};
+      auto it = _statistics.find(sql_view);
+      if (it == _statistics.end()) {
+        it = _statistics.emplace(std::string{sql_view}, statement_statistics_t{})
+                 .first;
+        it->second.sql = sql_view;
+      }
+      auto& statistics = it->second;
+      ++statistics.executions;
+      statistics.total_duration += duration;
+      statistics.max_duration = std::max(statistics.max_duration, duration);
+      statistics.fullscan_steps +=
+          take_counter(statement, SQLITE_STMTSTATUS_FULLSCAN_STEP);
+      statistics.sorts += take_counter(statement, SQLITE_STMTSTATUS_SORT);
+      statistics.autoindexes +=
+          take_counter(statement, SQLITE_STMTSTATUS_AUTOINDEX);
+      statistics.vm_steps += take_counter(statement, SQLITE_STMTSTATUS_VM_STEP);
+      statistics.reprepares +=
+          take_counter(statement, SQLITE_STMTSTATUS_REPREPARE);
+      statistics.max_memory_used =
+          std::max<std::int64_t>(statistics.max_memory_used,
+                                 sqlite3_stmt_status(
+                                     statement, SQLITE_STMTSTATUS_MEMUSED, 0));
+    } catch (...) {
+      // Statistics are not worth failing the statement for
+    }
+  }
+
+  // Sorted by total duration, longest first
+  [[nodiscard]] auto statistics() const -> std::vector<statement_statistics_t> {
+    auto result = std::vector<statement_statistics_t>{};
+    result.reserve(_statistics.size());
+    for (const auto& entry : _statistics) {
+      result.push_back(entry.second);
+    }
+    std::sort(result.begin(), result.end(), [](const auto& lhs, const auto& rhs) {
+      return lhs.total_duration > rhs.total_duration;
+    });
+    return result;
+  }
+
+  auto clear() -> void { _statistics.clear(); }
+};
+}  // namespace sqlpp::sqlite3
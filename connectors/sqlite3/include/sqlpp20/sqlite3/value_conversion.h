@@ -0,0 +1,109 @@
+#pragma once
+
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/wrong.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#ifdef SQLPP_USE_SQLCIPHER
+#include <sqlcipher/sqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+// Conversions between C++ values and the values that sqlite3 hands to and
+// expects from user defined tables and functions.
+namespace sqlpp::sqlite3::detail {
+inline auto set_context_result(::sqlite3_context* context,
+                               const std::nullopt_t&, sqlite3_destructor_type)
+    -> void {
+  sqlite3_result_null(context);
+}
+
+// Text is copied by sqlite3 unless `text_destructor` is SQLITE_STATIC
+template <typename T>
+auto set_context_result(::sqlite3_context* context, const T& value,
+                        sqlite3_destructor_type text_destructor) -> void {
+  if constexpr (std::is_integral_v<T>) {
+    sqlite3_result_int64(context, static_cast<sqlite3_int64>(value));
+  } else if constexpr (std::is_floating_point_v<T>) {
+    sqlite3_result_double(context, static_cast<double>(value));
+  } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+    const auto text = std::string_view{value};
+    sqlite3_result_text(context, text.data(), static_cast<int>(text.size()),
+                        text_destructor);
+  } else {
+    static_assert(wrong<T>, "only plain values can be handed to sqlite3");
+  }
+}
+
+template <typename T>
+auto set_context_result(::sqlite3_context* context,
+                        const std::optional<T>& value,
+                        sqlite3_destructor_type text_destructor) -> void {
+  if (value) {
+    set_context_result(context, *value, text_destructor);
+  } else {
+    sqlite3_result_null(context);
+  }
+}
+
+template <typename T>
+struct from_sqlite3_value {
+  // Text views point into the value, which is valid until the function returns
+  static auto get(::sqlite3_value* value) -> T {
+    if constexpr (std::is_same_v<T, bool>) {
+      return sqlite3_value_int64(value) != 0;
+    } else if constexpr (std::is_integral_v<T>) {
+      return static_cast<T>(sqlite3_value_int64(value));
+    } else if constexpr (std::is_floating_point_v<T>) {
+      return static_cast<T>(sqlite3_value_double(value));
+    } else if constexpr (std::is_same_v<T, std::string_view> or
+                         std::is_same_v<T, std::string>) {
+      const auto* text =
+          reinterpret_cast<const char*>(sqlite3_value_text(value));
+      return T(text ? text : "",
+               static_cast<std::size_t>(sqlite3_value_bytes(value)));
+    } else {
+      static_assert(wrong<T>, "only plain values can be read from sqlite3");
+    }
+  }
+};
+
+template <typename T>
+struct from_sqlite3_value<std::optional<T>> {
+  static auto get(::sqlite3_value* value) -> std::optional<T> {
+    if (sqlite3_value_type(value) == SQLITE_NULL) return std::nullopt;
+    return from_sqlite3_value<T>::get(value);
+  }
+};
+}  // namespace sqlpp::sqlite3::detail
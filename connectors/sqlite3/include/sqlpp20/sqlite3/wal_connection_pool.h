@@ -0,0 +1,248 @@
+#pragma once
+
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/sqlite3/checkpoint_manager.h>
+#include <sqlpp20/sqlite3/connection.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sqlpp::sqlite3::detail {
+// A mutex that is handed to waiting threads in the order of their arrival
+class fifo_mutex_t {
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  std::size_t _next_ticket = 0;
+  std::size_t _now_serving = 0;
+
+ public:
+  auto lock() -> void {
+    auto lock = std::unique_lock{_mutex};
+    const auto ticket = _next_ticket++;
+    _condition.wait(lock, [&] { return _now_serving == ticket; });
+  }
+
+  auto unlock() -> void {
+    {
+      const auto lock = std::scoped_lock{_mutex};
+      ++_now_serving;
+    }
+    _condition.notify_all();
+  }
+};
+}  // namespace sqlpp::sqlite3::detail
+
+namespace sqlpp::sqlite3 {
+// Rows of a select, together with the pooled connection they are read from
+template <typename Connection, typename Result>
+class pooled_result_t {
+  Connection _connection;
+  Result _result;
+
+ public:
+  pooled_result_t(Connection connection, Result result)
+      : _connection(std::move(connection)), _result(std::move(result)) {}
+
+  [[nodiscard]] auto begin() { return _result.begin(); }
+  [[nodiscard]] auto end() const { return _result.end(); }
+  [[nodiscard]] auto empty() -> bool { return _result.empty(); }
+  [[nodiscard]] auto front() -> decltype(auto) { return _result.front(); }
+  auto pop_front() -> void { _result.pop_front(); }
+};
+
+// Connection pool for databases in WAL mode: Writes go through a single
+// connection, one thread at a time in order of arrival. Reads are spread
+// over up to `reader_count` read-only connections, which can run in parallel
+// with each other and with the writer.
+//
+// The database has to be a file, as each connection opens it separately.
+//
+// With a checkpoint_config_t, checkpoints are run by a checkpoint_manager_t
+// instead of the writer's commits.
+template <::sqlpp::debug Debug>
+class wal_connection_pool_t {
+ public:
+  using reader_t = base_connection<wal_connection_pool_t, Debug>;
+  using writer_connection_t = base_connection<::sqlpp::no_pool, Debug>;
+
+  // Exclusive access to the writer connection, e.g. for transactions
+  class writer_t {
+    std::unique_lock<detail::fifo_mutex_t> _lock;
+    writer_connection_t* _connection;
+
+   public:
+    writer_t(detail::fifo_mutex_t& mutex, writer_connection_t& connection)
+        : _lock(mutex), _connection(&connection) {}
+
+    [[nodiscard]] auto operator*() const -> writer_connection_t& {
+      return *_connection;
+    }
+    [[nodiscard]] auto operator->() const -> writer_connection_t* {
+      return _connection;
+    }
+  };
+
+ private:
+  connection_config_t _reader_config;
+  std::size_t _reader_count;
+  // Declared before the writer, which is attached to it
+  std::unique_ptr<checkpoint_manager_t> _checkpoint_manager;
+  writer_connection_t _writer;
+  detail::fifo_mutex_t _writer_mutex;
+
+  std::mutex _reader_mutex;
+  std::condition_variable _reader_available;
+  std::vector<detail::pooled_handle_t> _idle_readers;
+  std::size_t _open_readers = 0;
+
+  friend reader_t;
+
+  static auto writer_config(connection_config_t config)
+      -> connection_config_t {
+    config.flags &= ~(SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX);
+    config.flags |= SQLITE_OPEN_READWRITE;
+    return config;
+  }
+
+  static auto reader_config(connection_config_t config)
+      -> connection_config_t {
+    // Each reader is used by a single thread at a time
+    config.flags &= ~(SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE |
+                      SQLITE_OPEN_FULLMUTEX);
+    config.flags |= SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX;
+    return config;
+  }
+
+  static auto enable_wal(writer_connection_t& writer)
+      -> writer_connection_t& {
+    if (detail::execute_pragma(writer.get(), "PRAGMA journal_mode = WAL") !=
+        "wal") {
+      throw sqlpp::exception("Sqlite3: Could not switch to WAL mode");
+    }
+    return writer;
+  }
+
+  auto put(detail::pooled_handle_t pooled) -> void {
+    if (not pooled.handle) {
+      return;
+    }
+    {
+      const auto lock = std::scoped_lock{_reader_mutex};
+      _idle_readers.push_back(std::move(pooled));
+    }
+    _reader_available.notify_one();
+  }
+
+  // Gives up a reader slot, whose connection could not be opened
+  auto release_slot() -> void {
+    {
+      const auto lock = std::scoped_lock{_reader_mutex};
+      --_open_readers;
+    }
+    _reader_available.notify_one();
+  }
+
+ public:
+  wal_connection_pool_t() = delete;
+  wal_connection_pool_t(std::size_t reader_count,
+                        const connection_config_t& connection_config)
+      : _reader_config(reader_config(connection_config)),
+        _reader_count(reader_count == 0 ? 1 : reader_count),
+        _writer(writer_config(connection_config)) {
+    enable_wal(_writer);
+  }
+  wal_connection_pool_t(std::size_t reader_count,
+                        const connection_config_t& connection_config,
+                        const checkpoint_config_t& checkpoint_config)
+      : wal_connection_pool_t(reader_count, connection_config) {
+    _checkpoint_manager = std::make_unique<checkpoint_manager_t>(
+        writer_config(connection_config), checkpoint_config);
+    _checkpoint_manager->attach(_writer.get());
+  }
+  wal_connection_pool_t(const wal_connection_pool_t&) = delete;
+  wal_connection_pool_t(wal_connection_pool_t&&) = delete;
+  wal_connection_pool_t& operator=(const wal_connection_pool_t&) = delete;
+  wal_connection_pool_t& operator=(wal_connection_pool_t&&) = delete;
+  ~wal_connection_pool_t() = default;
+
+  // Waits for an idle reader, if `reader_count` readers are in use
+  [[nodiscard]] auto reader() -> reader_t {
+    auto lock = std::unique_lock{_reader_mutex};
+    _reader_available.wait(lock, [this] {
+      return not _idle_readers.empty() or _open_readers < _reader_count;
+    });
+
+    if (not _idle_readers.empty()) {
+      auto pooled = std::move(_idle_readers.back());
+      _idle_readers.pop_back();
+      return reader_t{_reader_config, std::move(pooled), this};
+    }
+
+    ++_open_readers;
+    lock.unlock();
+    try {
+      return reader_t{_reader_config, this};
+    } catch (...) {
+      release_slot();
+      throw;
+    }
+  }
+
+  [[nodiscard]] auto writer() -> writer_t {
+    return writer_t{_writer_mutex, _writer};
+  }
+
+  // Without a checkpoint manager, there are no statistics
+  [[nodiscard]] auto checkpoint_statistics() const
+      -> std::optional<checkpoint_statistics_t> {
+    if (not _checkpoint_manager) return std::nullopt;
+    return _checkpoint_manager->statistics();
+  }
+
+  // Selects are executed by a reader, all other statements by the writer
+  template <typename... Clauses>
+  auto operator()(const ::sqlpp::statement<Clauses...>& statement) {
+    using _result_t = result_type_of_t<::sqlpp::statement<Clauses...>>;
+    if constexpr (std::is_same_v<_result_t, select_result>) {
+      auto connection = reader();
+      auto result = connection(statement);
+      return pooled_result_t<reader_t, decltype(result)>{std::move(connection),
+                                                         std::move(result)};
+    } else {
+      const auto writer = this->writer();
+      return (*writer)(statement);
+    }
+  }
+};
+}  // namespace sqlpp::sqlite3
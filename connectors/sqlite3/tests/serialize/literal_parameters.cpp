@@ -0,0 +1,92 @@
+/*
+Copyright (c) 2018 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <serialize/assert_equality.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/name_tag.h>
+#include <sqlpp20/operator.h>
+#include <sqlpp20/parameter.h>
+#include <sqlpp20/sqlite3/connection.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+using ::sqlpp::literal_parameters_t;
+using ::sqlpp::sqlite3::context_t;
+using ::sqlpp::test::assert_equality;
+using ::test::tabPerson;
+
+SQLPP_CREATE_NAME_TAG(foo);
+
+namespace {
+auto parameterized(const auto& t, literal_parameters_t& literals) {
+  auto context = context_t{};
+  context.literal_parameters = &literals;
+  return to_sql_string(context, t);
+}
+}  // namespace
+
+int main() {
+  try {
+    // Without a literal_parameters target, literals stay in the SQL text
+    assert_equality("tab_person.id = 42",
+                    to_sql_string_c(context_t{}, tabPerson.id == 42));
+
+    // Literal values are replaced by placeholders
+    {
+      auto literals = literal_parameters_t{};
+      assert_equality(
+          "SELECT tab_person.id FROM tab_person WHERE (tab_person.id = ?1) "
+          "AND (tab_person.name = ?2) AND (tab_person.is_manager = ?3)",
+          parameterized(select(tabPerson.id)
+                            .from(tabPerson)
+                            .where(tabPerson.id == 42 and
+                                   tabPerson.name == "Sam" and
+                                   tabPerson.isManager == true),
+                        literals));
+      if (literals != literal_parameters_t{std::int64_t{42}, std::string{"Sam"},
+                                           true}) {
+        throw std::runtime_error("Unexpected literal parameters");
+      }
+    }
+
+    // Parameters and lifted literals share the placeholder numbering, NULL
+    // stays in the SQL text
+    {
+      auto literals = literal_parameters_t{};
+      assert_equality(
+          "(tab_person.id = ?1) OR (tab_person.id = ?2) OR "
+          "(tab_person.address IS NULL)",
+          parameterized(tabPerson.id == ::sqlpp::parameter<std::int64_t>(foo) or
+                            tabPerson.id == 0.5 or tabPerson.address.is_null(),
+                        literals));
+      if (literals != literal_parameters_t{0.5}) {
+        throw std::runtime_error("Unexpected literal parameters");
+      }
+    }
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return -1;
+  }
+}
@@ -0,0 +1,216 @@
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/data_types.h>
+#include <sqlpp20/name_tag.h>
+#include <sqlpp20/sqlite3/connection.h>
+#include <sqlpp20/sqlite3_test/get_config.h>
+#include <sqlpp20/table.h>
+#include <sqlpp20_test/expect.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+struct TabDocument : public ::sqlpp::spec_base {
+  SQLPP_NAME_TAGS_FOR_SQL_AND_CPP(tab_document, tabDocument);
+
+  struct Id : public ::sqlpp::spec_base {
+    SQLPP_NAME_TAGS_FOR_SQL_AND_CPP(id, id);
+    using value_type = std::int64_t;
+    static constexpr auto can_be_null = false;
+    static constexpr auto has_default_value = false;
+    static constexpr auto has_auto_increment = true;
+  };
+
+  struct Name : public ::sqlpp::spec_base {
+    SQLPP_NAME_TAGS_FOR_SQL_AND_CPP(name, name);
+    using value_type = ::sqlpp::varchar<255>;
+    static constexpr auto can_be_null = false;
+    static constexpr auto has_default_value = false;
+    static constexpr auto has_auto_increment = false;
+  };
+
+  struct Content : public ::sqlpp::spec_base {
+    SQLPP_NAME_TAGS_FOR_SQL_AND_CPP(content, content);
+    using value_type = ::sqlpp::blob;
+    static constexpr auto can_be_null = true;
+    static constexpr auto has_default_value = false;
+    static constexpr auto has_auto_increment = false;
+  };
+
+  using _columns = ::sqlpp::type_vector<Id, Name, Content>;
+
+  using primary_key = ::sqlpp::type_vector<Id>;
+};
+inline constexpr auto tabDocument = ::sqlpp::table_t<TabDocument>{};
+
+using ::sqlpp::test::expect;
+using ::sqlpp::test::expect_exception;
+
+auto make_content(std::size_t size) -> std::vector<std::uint8_t> {
+  auto content = std::vector<std::uint8_t>(size);
+  for (auto i = std::size_t{0}; i < size; ++i) {
+    content[i] = static_cast<std::uint8_t>(i * 7);
+  }
+  return content;
+}
+}  // namespace
+
+int main() {
+  try {
+    const auto config = ::sqlpp::sqlite3::test::get_config();
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+    db(drop_table(tabDocument));
+    db(create_table(tabDocument));
+
+    // Small values as literals
+    const auto small = std::vector<std::uint8_t>{0x00, 0x7F, 0xAB, 0xFF};
+    db(insert_into(tabDocument)
+           .set(tabDocument.name = "small", tabDocument.content = small));
+
+    // Large values are reserved with zeroblob() and streamed in chunks
+    const auto large = make_content(100'000);
+    const auto rowid =
+        db(insert_into(tabDocument)
+               .set(tabDocument.name = "large",
+                    tabDocument.content = ::sqlpp::sqlite3::zeroblob(
+                        static_cast<std::int64_t>(large.size()))));
+    {
+      auto stream = db.open_blob(tabDocument.content, rowid,
+                                 ::sqlpp::sqlite3::blob_mode::read_write);
+      expect(stream.size() == large.size(), "unexpected size of zeroblob");
+      constexpr auto chunk_size = std::size_t{4096};
+      for (auto offset = std::size_t{0}; offset < large.size();
+           offset += chunk_size) {
+        const auto chunk = std::span<const std::uint8_t>{large}.subspan(
+            offset, std::min(chunk_size, large.size() - offset));
+        stream.write(chunk, offset);
+      }
+    }
+
+    {
+      const auto stream = db.open_blob(tabDocument.content, rowid);
+      auto buffer = std::array<std::uint8_t, 1000>{};
+      auto streamed = std::vector<std::uint8_t>{};
+      auto chunks = 0;
+      stream.read_chunks(buffer, [&](std::span<const std::uint8_t> chunk) {
+        streamed.insert(streamed.end(), chunk.begin(), chunk.end());
+        ++chunks;
+      });
+      expect(streamed == large, "unexpected streamed content");
+      expect(chunks == 100, "unexpected number of chunks");
+
+      // Read-only streams cannot write
+      try {
+        auto writer = db.open_blob(tabDocument.content, rowid);
+        writer.write(small, 0);
+        throw std::logic_error("wrote to a read-only blob stream");
+      } catch (const ::sqlpp::exception&) {
+      }
+    }
+
+    // Selected values refer to the statement's memory
+    auto sizes = std::vector<std::size_t>{};
+    for (const auto& row :
+         db(select(tabDocument.name, tabDocument.content)
+                .from(tabDocument)
+                .unconditionally())) {
+      expect(row.content.has_value(), "unexpected NULL content");
+      const auto content = *row.content;
+      if (row.name == "small") {
+        expect(std::ranges::equal(content, small),
+               "unexpected small content");
+      } else {
+        expect(std::ranges::equal(content, large),
+               "unexpected large content");
+      }
+      sizes.push_back(content.size());
+    }
+    std::sort(sizes.begin(), sizes.end());
+    expect(sizes == std::vector<std::size_t>{small.size(), large.size()},
+           "unexpected sizes of selected content");
+
+    // Parameters are bound without copying
+    auto prepared_insert = db.prepare(insert_into(tabDocument)
+                                          .set(tabDocument.name = "bound",
+                                               tabDocument.content =
+                                                   ::sqlpp::parameter<
+                                                       std::span<
+                                                           const std::uint8_t>>(
+                                                       tabDocument.content)));
+    prepared_insert.parameters.content = std::span<const std::uint8_t>{large};
+    const auto bound_rowid = execute(prepared_insert);
+    expect(db.open_blob(tabDocument.content, bound_rowid).size() ==
+               large.size(),
+           "unexpected size of bound content");
+
+    // Misuse is reported instead of looping forever or truncating values
+    {
+      auto stream = db.open_blob(tabDocument.content, rowid);
+      auto empty = std::span<std::uint8_t>{};
+      expect_exception([&] { stream.read_chunks(empty, [](auto) {}); },
+                       "read chunks into an empty buffer");
+      auto byte = std::array<std::uint8_t, 1>{};
+      expect_exception(
+          [&] {
+            stream.read(byte, std::size_t{std::numeric_limits<int>::max()} + 1);
+          },
+          "read at an offset beyond int");
+
+      auto moved_to = std::move(stream);
+      expect_exception([&] { [[maybe_unused]] auto size = stream.size(); },
+                       "used a moved-from blob stream");
+      expect(moved_to.size() == large.size(), "unexpected size after move");
+    }
+
+    // Tables of attached databases
+    db("ATTACH DATABASE ':memory:' AS aux");
+    db("CREATE TABLE aux.tab_document (id INTEGER PRIMARY KEY, name TEXT, "
+       "content BLOB)");
+    db("INSERT INTO aux.tab_document (id, name, content) VALUES (1, 'aux', "
+       "X'010203')");
+    expect(db.open_blob(tabDocument.content, 1,
+                        ::sqlpp::sqlite3::blob_mode::read_only, "aux")
+                   .size() == 3,
+           "unexpected size of attached content");
+    db("DETACH DATABASE aux");
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
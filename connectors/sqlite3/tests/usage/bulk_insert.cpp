@@ -0,0 +1,138 @@
+/*
+Copyright (c) 2018 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/function.h>
+#include <sqlpp20/sqlite3/connection.h>
+#include <sqlpp20/sqlite3_test/get_config.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+using test::tabPerson;
+
+SQLPP_CREATE_NAME_TAG(rowCount);
+
+struct person {
+  std::int64_t id;
+  std::string name;
+  std::optional<std::string> address;
+};
+
+template <typename Db>
+auto count_rows(Db& db) -> std::int64_t {
+  for (const auto& row :
+       db(select(::sqlpp::count(::sqlpp::asterisk).as(rowCount))
+              .from(tabPerson)
+              .unconditionally())) {
+    return row.rowCount;
+  }
+  throw std::runtime_error("missing row count");
+}
+
+using ::sqlpp::test::expect;
+}  // namespace
+
+int main() {
+  try {
+    const auto config = ::sqlpp::sqlite3::test::get_config();
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+    db(drop_table(tabPerson));
+    db(create_table(tabPerson));
+
+    // Rows of assignments
+    {
+      using row_t = std::tuple<decltype(tabPerson.name = std::string{}),
+                               decltype(tabPerson.isManager = true),
+                               decltype(tabPerson.language = "")>;
+      auto rows = std::vector<row_t>{};
+      for (auto i = 0; i < 5000; ++i) {
+        rows.emplace_back(tabPerson.name = "person " + std::to_string(i),
+                          tabPerson.isManager = (i % 10 == 0),
+                          tabPerson.language = "en");
+      }
+
+      auto options = ::sqlpp::sqlite3::bulk_insert_options_t{};
+      options.rows_per_transaction = 1000;
+      options.relax_durability = true;
+      const auto result = db.bulk_insert(tabPerson, rows, options);
+      expect(result.rows == 5000, "unexpected number of rows");
+      expect(result.rows_per_second() > 0, "unexpected rows per second");
+      expect(count_rows(db) == 5000, "unexpected row count");
+
+      // The durability settings are restored after the load
+      expect(::sqlpp::sqlite3::detail::execute_pragma(
+                 db.get(), "PRAGMA synchronous") != "0",
+             "synchronous has not been restored");
+    }
+
+    // Rows of any type, turned into assignments by a projection
+    {
+      auto people = std::vector<person>{{10001, "Alice", std::nullopt},
+                                        {10002, "Bob", "Main St. 1"}};
+      const auto to_row = [](const person& p) {
+        return std::tuple(tabPerson.id = p.id, tabPerson.name = p.name,
+                          tabPerson.isManager = false,
+                          tabPerson.address = p.address);
+      };
+      expect(db.bulk_insert(tabPerson, people, {}, to_row).rows == 2,
+             "unexpected number of rows");
+      expect(count_rows(db) == 5002, "unexpected row count");
+
+      // The failing row's transaction is rolled back
+      try {
+        db.bulk_insert(tabPerson, people, {}, to_row);
+        throw std::logic_error("duplicate ids have been accepted");
+      } catch (const ::sqlpp::exception&) {
+      }
+      expect(count_rows(db) == 5002, "rows of failed insert have been kept");
+    }
+
+    // Within an open transaction, all rows go into that transaction
+    {
+      auto transaction = start_transaction(db);
+      const auto rows = std::vector{
+          std::tuple(tabPerson.name = std::string{"Carol"},
+                     tabPerson.isManager = true)};
+      db.bulk_insert(tabPerson, rows);
+      transaction.rollback();
+      expect(count_rows(db) == 5002, "rows of rolled back insert were kept");
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,162 @@
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/sqlite3/checkpoint_manager.h>
+#include <sqlpp20/sqlite3/wal_connection_pool.h>
+#include <sqlpp20/sqlite3_test/get_config.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabDepartment.h>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+using test::tabDepartment;
+
+using ::sqlpp::test::expect;
+
+// Waits up to a few seconds for the background thread
+template <typename Predicate>
+auto eventually(Predicate predicate) -> bool {
+  for (auto i = 0; i < 500; ++i) {
+    if (predicate()) return true;
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+  }
+  return false;
+}
+}  // namespace
+
+int main() {
+  try {
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.path_to_database = "sqlpp20_test_checkpoint";
+    config.debug = {};
+
+    // Checkpoints on a plain connection
+    {
+      auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+      db("PRAGMA journal_mode = WAL");
+      db(drop_table(tabDepartment));
+      db(create_table(tabDepartment));
+
+      auto checkpoint_config = ::sqlpp::sqlite3::checkpoint_config_t{};
+      checkpoint_config.passive_frames = 10;
+      checkpoint_config.idle_time = std::chrono::milliseconds{20};
+      checkpoint_config.poll_interval = std::chrono::milliseconds{5};
+      auto manager =
+          ::sqlpp::sqlite3::checkpoint_manager_t{config, checkpoint_config};
+      manager.attach(db.get());
+
+      for (auto i = 0; i < 50; ++i) {
+        db(insert_into(tabDepartment).default_values());
+      }
+
+      expect(eventually([&] {
+               const auto statistics = manager.statistics();
+               return statistics.passive_checkpoints > 0 and
+                      statistics.checkpointed_frames ==
+                          statistics.wal_frames;
+             }),
+             "WAL has not been checkpointed");
+      const auto statistics = manager.statistics();
+      expect(statistics.wal_bytes >= statistics.wal_frames,
+             "unexpected WAL size");
+      expect(statistics.failed_checkpoints == 0, "checkpoint failed");
+      expect(statistics.total_duration >= statistics.max_duration,
+             "unexpected checkpoint durations");
+
+      manager.detach(db.get());
+    }
+
+    // A large WAL is restarted
+    {
+      auto checkpoint_config = ::sqlpp::sqlite3::checkpoint_config_t{};
+      checkpoint_config.passive_frames = 1000;
+      checkpoint_config.restart_frames = 20;
+      checkpoint_config.poll_interval = std::chrono::milliseconds{5};
+      auto pool = ::sqlpp::sqlite3::wal_connection_pool_t<::sqlpp::debug::none>{
+          2, config, checkpoint_config};
+      expect(pool.checkpoint_statistics().has_value(),
+             "missing checkpoint statistics");
+      // Writers wait for RESTART checkpoints, which lock out writers briefly
+      sqlite3_busy_timeout(pool.writer()->get(), 1000);
+
+      for (auto i = 0; i < 50; ++i) {
+        pool(insert_into(tabDepartment).default_values());
+      }
+      expect(eventually([&] {
+               return pool.checkpoint_statistics()->restart_checkpoints > 0;
+             }),
+             "WAL has not been restarted");
+
+      // Checkpoints blocked by a reader are retried once per poll interval
+      {
+        // The reader's snapshot ends within the WAL, which therefore cannot
+        // be checkpointed completely while the reader is active
+        expect(eventually([&] {
+                 return pool.checkpoint_statistics()->wal_frames == 0;
+               }),
+               "WAL has not been restarted");
+        pool(insert_into(tabDepartment).default_values());
+        auto reader =
+            ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+        sqlite3_busy_timeout(reader.get(), 1000);
+        reader("BEGIN");
+        expect(not reader(select(tabDepartment.id)
+                              .from(tabDepartment)
+                              .unconditionally())
+                       .empty(),
+               "missing rows");
+        for (auto i = 0; i < 50; ++i) {
+          pool(insert_into(tabDepartment).default_values());
+        }
+        const auto busy_before = pool.checkpoint_statistics()->busy_checkpoints;
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+        const auto busy_after = pool.checkpoint_statistics()->busy_checkpoints;
+        expect(busy_after > busy_before, "blocked checkpoints not retried");
+        expect(busy_after - busy_before < 40,
+               "blocked checkpoints are retried without waiting");
+        reader("COMMIT");
+      }
+
+      auto plain_pool =
+          ::sqlpp::sqlite3::wal_connection_pool_t<::sqlpp::debug::none>{
+              2, config};
+      expect(not plain_pool.checkpoint_statistics(),
+             "unexpected checkpoint statistics");
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
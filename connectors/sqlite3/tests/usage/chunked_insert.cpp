@@ -0,0 +1,174 @@
+/*
+Copyright (c) 2018 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <sqlpp20/chunked_insert.h>
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/delete_from.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/function.h>
+#include <sqlpp20/sqlite3/connection.h>
+#include <sqlpp20/sqlite3_test/get_config.h>
+#include <sqlpp20/transaction.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+using test::tabPerson;
+
+SQLPP_CREATE_NAME_TAG(rowCount);
+
+using row_t = std::tuple<decltype(tabPerson.id = std::int64_t{}),
+                         decltype(tabPerson.name = std::string{}),
+                         decltype(tabPerson.isManager = true)>;
+
+auto make_rows(std::int64_t first_id, std::size_t count) {
+  auto rows = std::vector<row_t>{};
+  for (auto i = std::size_t{0}; i < count; ++i) {
+    const auto id = first_id + static_cast<std::int64_t>(i);
+    rows.emplace_back(tabPerson.id = id,
+                      tabPerson.name = "person '" + std::to_string(id) + "'",
+                      tabPerson.isManager = (id % 7 == 0));
+  }
+  return rows;
+}
+
+template <typename Db>
+auto count_rows(Db& db) -> std::int64_t {
+  for (const auto& row :
+       db(select(::sqlpp::count(::sqlpp::asterisk).as(rowCount))
+              .from(tabPerson)
+              .unconditionally())) {
+    return row.rowCount;
+  }
+  throw std::runtime_error("missing row count");
+}
+
+using ::sqlpp::test::expect;
+}  // namespace
+
+int main() {
+  try {
+    const auto config = ::sqlpp::sqlite3::test::get_config();
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+    db(drop_table(tabPerson));
+    db(create_table(tabPerson));
+
+    // The server limits are far beyond a thousand small rows
+    {
+      const auto result = execute_chunked(
+          db, insert_into(tabPerson).multiset(make_rows(1, 1000)));
+      expect(result.affected_rows == 1000, "unexpected number of rows");
+      expect(result.insert_ids.size() == 1 and result.insert_ids[0] == 1000,
+             "unexpected insert ids");
+    }
+
+    // Small limits split the rows into several statements
+    {
+      auto limits = ::sqlpp::insert_chunk_limits_t{};
+      limits.max_sql_length = 2000;
+      limits.max_parameters = 300;  // 100 rows
+      const auto result = execute_chunked(
+          db, insert_into(tabPerson).multiset(make_rows(1001, 1000)), limits);
+      expect(result.affected_rows == 1000, "unexpected number of rows");
+      expect(result.insert_ids.size() > 10, "unexpected number of chunks");
+      expect(result.insert_ids.back() == 2000, "unexpected last insert id");
+      expect(count_rows(db) == 2000, "unexpected row count");
+    }
+
+    // A failing chunk rolls back the ones before
+    {
+      auto limits = ::sqlpp::insert_chunk_limits_t{};
+      limits.max_parameters = 300;
+      try {
+        execute_chunked(
+            db, insert_into(tabPerson).multiset(make_rows(1500, 1000)), limits);
+        throw std::logic_error("duplicate ids have been accepted");
+      } catch (const ::sqlpp::exception&) {
+      }
+      expect(count_rows(db) == 2000, "rows of failed insert have been kept");
+    }
+
+    // Affected rows are reported by the connection, here without the rows
+    // that a trigger skips
+    {
+      db("CREATE TRIGGER skip_odd_ids BEFORE INSERT ON tab_person "
+         "WHEN NEW.id % 2 = 1 BEGIN SELECT RAISE(IGNORE); END");
+      auto limits = ::sqlpp::insert_chunk_limits_t{};
+      limits.max_parameters = 300;
+      const auto result = execute_chunked(
+          db, insert_into(tabPerson).multiset(make_rows(2001, 1000)), limits);
+      db("DROP TRIGGER skip_odd_ids");
+      expect(result.insert_ids.size() == 10, "unexpected number of chunks");
+      expect(result.affected_rows == 500, "unexpected number of rows");
+      expect(count_rows(db) == 2500, "unexpected row count");
+      db(delete_from(tabPerson).where(tabPerson.id > 2000));
+    }
+
+    // The parameter limit only applies if literals are parameters
+    {
+      expect(db.insert_chunk_limits().max_parameters ==
+                 std::numeric_limits<std::size_t>::max(),
+             "parameter limit without parameterized literals");
+      auto parameterizing_config = config;
+      parameterizing_config.parameterize_literals = true;
+      auto parameterizing_db =
+          ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{
+              parameterizing_config};
+      expect(parameterizing_db.insert_chunk_limits().max_parameters ==
+                 static_cast<std::size_t>(sqlite3_limit(
+                     parameterizing_db.get(), SQLITE_LIMIT_VARIABLE_NUMBER,
+                     -1)),
+             "unexpected parameter limit with parameterized literals");
+    }
+
+    // Chunks join a transaction opened by the caller
+    {
+      auto limits = ::sqlpp::insert_chunk_limits_t{};
+      limits.max_parameters = 300;
+      auto tx = start_transaction(db);
+      const auto result = execute_chunked(
+          db, insert_into(tabPerson).multiset(make_rows(3001, 1000)), limits);
+      expect(result.insert_ids.size() > 1, "unexpected number of chunks");
+      expect(db.is_transaction_active(), "transaction has been closed");
+      expect(count_rows(db) == 3000, "unexpected row count in transaction");
+      tx.rollback();
+      expect(count_rows(db) == 2000, "rows have been kept after rollback");
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,204 @@
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/sqlite3/connection.h>
+#include <sqlpp20/sqlite3_test/get_config.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+using test::tabPerson;
+
+SQLPP_CREATE_NAME_TAG(is_prime);
+SQLPP_CREATE_NAME_TAG(shout);
+SQLPP_CREATE_NAME_TAG(median);
+SQLPP_CREATE_NAME_TAG(total);
+SQLPP_CREATE_NAME_TAG(loud);
+SQLPP_CREATE_NAME_TAG(middle);
+SQLPP_CREATE_NAME_TAG(sum);
+SQLPP_CREATE_NAME_TAG(fail);
+
+constexpr auto isPrime =
+    ::sqlpp::sqlite3::scalar_function<bool(std::int64_t)>(is_prime);
+constexpr auto shoutOf =
+    ::sqlpp::sqlite3::scalar_function<std::string(std::string_view)>(shout);
+constexpr auto medianOf =
+    ::sqlpp::sqlite3::aggregate_function<std::optional<double>(double)>(
+        median);
+constexpr auto totalOf =
+    ::sqlpp::sqlite3::aggregate_function<std::int64_t(std::int64_t)>(total);
+constexpr auto failing =
+    ::sqlpp::sqlite3::scalar_function<bool(std::int64_t)>(fail);
+
+struct median_t {
+  std::vector<double> values;
+
+  auto step(double value) -> void { values.push_back(value); }
+
+  auto finalize() -> std::optional<double> {
+    if (values.empty()) return std::nullopt;
+    std::sort(values.begin(), values.end());
+    const auto size = values.size();
+    return size % 2 ? values[size / 2]
+                    : (values[size / 2 - 1] + values[size / 2]) / 2;
+  }
+};
+
+// Can be used as window function, too
+struct total_t {
+  std::int64_t sum = 0;
+
+  auto step(std::int64_t value) -> void { sum += value; }
+  auto inverse(std::int64_t value) -> void { sum -= value; }
+  auto value() const -> std::int64_t { return sum; }
+  auto finalize() const -> std::int64_t { return sum; }
+};
+
+using ::sqlpp::test::expect;
+}  // namespace
+
+int main() {
+  try {
+    const auto config = ::sqlpp::sqlite3::test::get_config();
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+    db(drop_table(tabPerson));
+    db(create_table(tabPerson));
+    for (auto i = 1; i <= 10; ++i) {
+      db(insert_into(tabPerson).set(tabPerson.id = i,
+                                    tabPerson.name = "person " +
+                                                     std::to_string(i),
+                                    tabPerson.isManager = false));
+    }
+
+    db.register_function(isPrime, [](std::int64_t n) {
+      if (n < 2) return false;
+      for (auto k = std::int64_t{2}; k * k <= n; ++k) {
+        if (n % k == 0) return false;
+      }
+      return true;
+    });
+    db.register_function(shoutOf, [](std::string_view text) {
+      auto result = std::string{text};
+      std::transform(result.begin(), result.end(), result.begin(),
+                     [](unsigned char c) { return std::toupper(c); });
+      return result + "!";
+    });
+    db.register_aggregate<median_t>(medianOf);
+    db.register_aggregate<total_t>(totalOf);
+
+    // Scalar functions filter rows inside the engine
+    {
+      auto ids = std::vector<std::int64_t>{};
+      for (const auto& row : db(select(tabPerson.id)
+                                    .from(tabPerson)
+                                    .where(isPrime(tabPerson.id)))) {
+        ids.push_back(row.id);
+      }
+      expect(ids == std::vector<std::int64_t>{2, 3, 5, 7},
+             "unexpected prime ids");
+    }
+
+    // and compute selected values
+    {
+      auto count = 0;
+      for (const auto& row : db(select(shoutOf(tabPerson.name).as(loud))
+                                    .from(tabPerson)
+                                    .where(tabPerson.id == 3))) {
+        expect(row.loud == "PERSON 3!", "unexpected scalar function result");
+        ++count;
+      }
+      expect(count == 1, "unexpected number of rows");
+    }
+
+    // Aggregates
+    {
+      for (const auto& row : db(select(medianOf(tabPerson.id).as(middle),
+                                       totalOf(tabPerson.id).as(sum))
+                                    .from(tabPerson)
+                                    .unconditionally())) {
+        expect(row.middle == 5.5, "unexpected median");
+        expect(row.sum == 55, "unexpected total");
+      }
+
+      // Groups without rows
+      for (const auto& row : db(select(medianOf(tabPerson.id).as(middle),
+                                       totalOf(tabPerson.id).as(sum))
+                                    .from(tabPerson)
+                                    .where(tabPerson.id > 100))) {
+        expect(not row.middle, "unexpected median of no rows");
+        expect(row.sum == 0, "unexpected total of no rows");
+      }
+    }
+
+    // Accumulators with inverse() and value() are window functions
+    {
+      auto totals = std::vector<std::int64_t>{};
+      const auto rc = sqlite3_exec(
+          db.get(),
+          "SELECT total(id) OVER (ORDER BY id ROWS 1 PRECEDING) FROM "
+          "tab_person WHERE id <= 4",
+          [](void* data, int, char** values, char**) {
+            static_cast<std::vector<std::int64_t>*>(data)->push_back(
+                std::stoll(values[0]));
+            return 0;
+          },
+          &totals, nullptr);
+      expect(rc == SQLITE_OK, "window function failed");
+      expect(totals == std::vector<std::int64_t>{1, 3, 5, 7},
+             "unexpected window function results");
+    }
+
+    // Exceptions are reported as errors of the statement
+    {
+      db.register_function(failing, [](std::int64_t) -> bool {
+        throw std::runtime_error("failing on purpose");
+      });
+      try {
+        for ([[maybe_unused]] const auto& row :
+             db(select(tabPerson.id).from(tabPerson).where(
+                 failing(tabPerson.id)))) {
+        }
+        throw std::logic_error("function exception has been ignored");
+      } catch (const ::sqlpp::exception&) {
+      }
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,181 @@
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/function.h>
+#include <sqlpp20/sqlite3/group_commit.h>
+#include <sqlpp20/sqlite3_test/get_config.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <future>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+using test::tabPerson;
+
+SQLPP_CREATE_NAME_TAG(rowCount);
+
+template <typename Db>
+auto count_rows(Db& db) -> std::int64_t {
+  for (const auto& row :
+       db(select(::sqlpp::count(::sqlpp::asterisk).as(rowCount))
+              .from(tabPerson)
+              .unconditionally())) {
+    return row.rowCount;
+  }
+  throw std::runtime_error("missing row count");
+}
+
+using ::sqlpp::test::expect;
+}  // namespace
+
+int main() {
+  try {
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.debug = {};
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+    db(drop_table(tabPerson));
+    db(create_table(tabPerson));
+
+    // Statements of many threads share transactions
+    {
+      auto writer =
+          ::sqlpp::sqlite3::group_commit_writer_t<::sqlpp::debug::none>{
+              config, {.max_batch_size = 64,
+                       .window = std::chrono::milliseconds{5}}};
+      constexpr auto thread_count = 8;
+      constexpr auto inserts_per_thread = 50;
+      auto ids = std::vector<std::vector<std::int64_t>>(thread_count);
+      auto threads = std::vector<std::thread>{};
+      for (auto i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&, i] {
+          for (auto k = 0; k < inserts_per_thread; ++k) {
+            auto future = writer.submit(
+                insert_into(tabPerson).set(tabPerson.name = "someone",
+                                           tabPerson.isManager = false));
+            ids[i].push_back(future.get());
+          }
+        });
+      }
+      for (auto&& t : threads) {
+        t.join();
+      }
+
+      auto unique_ids = std::set<std::int64_t>{};
+      for (const auto& thread_ids : ids) {
+        unique_ids.insert(thread_ids.begin(), thread_ids.end());
+      }
+      expect(unique_ids.size() == thread_count * inserts_per_thread,
+             "unexpected number of inserted ids");
+      expect(count_rows(db) == thread_count * inserts_per_thread,
+             "unexpected row count");
+
+      const auto statistics = writer.statistics();
+      expect(statistics.statements == thread_count * inserts_per_thread,
+             "unexpected number of statements");
+      expect(statistics.transactions < statistics.statements,
+             "statements have not been grouped");
+      expect(statistics.failed_statements == 0, "unexpected failures");
+    }
+
+    // A failing statement does not affect the others of its batch
+    {
+      auto writer =
+          ::sqlpp::sqlite3::group_commit_writer_t<::sqlpp::debug::none>{
+              config, {.max_batch_size = 3,
+                       .window = std::chrono::seconds{1}}};
+      auto first = writer.submit(insert_into(tabPerson).set(
+          tabPerson.id = 1000, tabPerson.name = "first",
+          tabPerson.isManager = false));
+      auto duplicate = writer.submit(insert_into(tabPerson).set(
+          tabPerson.id = 1000, tabPerson.name = "duplicate",
+          tabPerson.isManager = false));
+      auto last = writer.submit(insert_into(tabPerson).set(
+          tabPerson.id = 1001, tabPerson.name = "last",
+          tabPerson.isManager = false));
+
+      expect(first.get() == 1000, "unexpected id of first insert");
+      try {
+        duplicate.get();
+        throw std::logic_error("duplicate id has been accepted");
+      } catch (const ::sqlpp::exception&) {
+      }
+      expect(last.get() == 1001, "unexpected id of last insert");
+
+      const auto statistics = writer.statistics();
+      expect(statistics.transactions == 1, "unexpected number of batches");
+      expect(statistics.failed_statements == 1, "unexpected failures");
+      expect(count_rows(db) == 402, "unexpected row count");
+    }
+
+    // A statement that rolls back the whole transaction does not take the
+    // others of its batch along
+    db("CREATE TRIGGER rollback_person BEFORE INSERT ON tab_person "
+       "WHEN NEW.name = 'rollback' "
+       "BEGIN SELECT RAISE(ROLLBACK, 'rolled back'); END");
+    {
+      auto writer =
+          ::sqlpp::sqlite3::group_commit_writer_t<::sqlpp::debug::none>{
+              config, {.max_batch_size = 3,
+                       .window = std::chrono::seconds{1}}};
+      auto first = writer.submit(insert_into(tabPerson).set(
+          tabPerson.id = 2000, tabPerson.name = "first",
+          tabPerson.isManager = false));
+      auto rollback = writer.submit(insert_into(tabPerson).set(
+          tabPerson.id = 2001, tabPerson.name = "rollback",
+          tabPerson.isManager = false));
+      auto last = writer.submit(insert_into(tabPerson).set(
+          tabPerson.id = 2002, tabPerson.name = "last",
+          tabPerson.isManager = false));
+
+      expect(first.get() == 2000, "unexpected id of first insert");
+      try {
+        rollback.get();
+        throw std::logic_error("rollback has been ignored");
+      } catch (const ::sqlpp::exception&) {
+      }
+      expect(last.get() == 2002, "unexpected id of last insert");
+
+      const auto statistics = writer.statistics();
+      expect(statistics.transactions == 1, "unexpected number of batches");
+      expect(statistics.failed_statements == 1, "unexpected failures");
+      expect(count_rows(db) == 404, "unexpected row count");
+    }
+    db("DROP TRIGGER rollback_person");
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,144 @@
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/function.h>
+#include <sqlpp20/sqlite3/connection.h>
+#include <sqlpp20/sqlite3/connection_pool.h>
+#include <sqlpp20/sqlite3_test/get_config.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabDepartment.h>
+
+#include <atomic>
+#include <cstdio>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+using test::tabDepartment;
+
+SQLPP_CREATE_NAME_TAG(rowCount);
+
+template <typename Db>
+auto count_rows(Db& db) -> std::int64_t {
+  for (const auto& row :
+       db(select(::sqlpp::count(::sqlpp::asterisk).as(rowCount))
+              .from(tabDepartment)
+              .unconditionally())) {
+    return row.rowCount;
+  }
+  throw std::runtime_error("missing row count");
+}
+
+using ::sqlpp::test::expect;
+}  // namespace
+
+int main() {
+  try {
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.path_to_database = "sqlpp20_test_image";
+    config.debug = {};
+    {
+      auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+      db(drop_table(tabDepartment));
+      db(create_table(tabDepartment));
+      for (auto i = 0; i < 100; ++i) {
+        db(insert_into(tabDepartment).default_values());
+      }
+    }
+
+    const auto memory_config =
+        ::sqlpp::sqlite3::in_memory_config(config, "sqlpp20_test_image");
+    auto pool = ::sqlpp::sqlite3::connection_pool_t<::sqlpp::debug::none>{
+        2, memory_config};
+    {
+      // The first connection loads the file, the second one shares the image
+      auto first = pool.get();
+      auto second = pool.get();
+      expect(count_rows(first) == 100, "database has not been loaded");
+      first(insert_into(tabDepartment).default_values());
+      expect(count_rows(second) == 101, "image is not shared");
+
+      // The file is left untouched
+      auto file = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+      expect(count_rows(file) == 100, "file has been changed");
+
+      std::remove("sqlpp20_test_snapshot");
+      second.save_to("sqlpp20_test_snapshot");
+    }
+
+    auto snapshot_config = config;
+    snapshot_config.path_to_database = "sqlpp20_test_snapshot";
+    auto snapshot =
+        ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{snapshot_config};
+    expect(count_rows(snapshot) == 101, "unexpected snapshot content");
+
+    if (not sqlite3_threadsafe()) {
+      std::clog << "sqlite3 not compiled with thread safety.\n";
+      std::clog << "Not running multi-threaded tests.\n";
+      return 0;
+    }
+
+    // Connections opened concurrently load the file once
+    {
+      const auto concurrent_config =
+          ::sqlpp::sqlite3::in_memory_config(config, "sqlpp20_test_concurrent");
+      constexpr auto thread_count = 8;
+      auto connections = std::vector<std::optional<
+          ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>>>(thread_count);
+      auto failed = std::atomic<bool>{false};
+      auto threads = std::vector<std::thread>{};
+      for (auto i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&, i] {
+          try {
+            connections[i].emplace(concurrent_config);
+          } catch (const std::exception& e) {
+            std::cerr << "Thread exception: " << e.what() << std::endl;
+            failed = true;
+          }
+        });
+      }
+      for (auto&& t : threads) {
+        t.join();
+      }
+      expect(not failed, "concurrent loads failed");
+      for (auto i = 0; i < thread_count; ++i) {
+        (*connections[i])(insert_into(tabDepartment).default_values());
+      }
+      expect(count_rows(*connections.front()) == 100 + thread_count,
+             "unexpected row count after concurrent loads");
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
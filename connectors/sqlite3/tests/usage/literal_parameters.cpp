@@ -0,0 +1,86 @@
+/*
+Copyright (c) 2018 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/delete_from.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/clause/update.h>
+#include <sqlpp20/sqlite3/connection.h>
+#include <sqlpp20/sqlite3_test/get_config.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+using test::tabPerson;
+
+using ::sqlpp::test::expect;
+}  // namespace
+
+int main() {
+  try {
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.parameterize_literals = true;
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::allowed>{config};
+    db(drop_table(tabPerson));
+    db(create_table(tabPerson));
+
+    // Values are bound, so quotes need no escaping in the SQL text
+    const auto id = db(insert_into(tabPerson).set(
+        tabPerson.name = "O'Reilly", tabPerson.isManager = true,
+        tabPerson.address = std::nullopt));
+    db(insert_into(tabPerson).set(tabPerson.name = "Sam",
+                                  tabPerson.isManager = false,
+                                  tabPerson.address = "Main St. 1"));
+
+    auto found = 0;
+    for (const auto& row :
+         db(select(tabPerson.id, tabPerson.name, tabPerson.isManager)
+                .from(tabPerson)
+                .where(tabPerson.name == "O'Reilly" and tabPerson.id < 1000))) {
+      expect(row.id == id, "unexpected id");
+      expect(row.name == "O'Reilly", "unexpected name");
+      expect(row.isManager, "unexpected is_manager");
+      ++found;
+    }
+    expect(found == 1, "unexpected number of rows");
+
+    expect(db(update(tabPerson)
+                  .set(tabPerson.address = "Main St. 2")
+                  .where(tabPerson.id == id)) == 1,
+           "unexpected number of updated rows");
+    expect(db(delete_from(tabPerson).where(tabPerson.isManager == false)) == 1,
+           "unexpected number of deleted rows");
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
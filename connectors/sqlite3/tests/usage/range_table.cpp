@@ -0,0 +1,172 @@
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/data_types.h>
+#include <sqlpp20/join.h>
+#include <sqlpp20/name_tag.h>
+#include <sqlpp20/sqlite3/connection.h>
+#include <sqlpp20/sqlite3_test/get_config.h>
+#include <sqlpp20/table.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+using test::tabPerson;
+
+struct TabKey : public ::sqlpp::spec_base {
+  SQLPP_NAME_TAGS_FOR_SQL_AND_CPP(tab_key, tabKey);
+
+  struct Id : public ::sqlpp::spec_base {
+    SQLPP_NAME_TAGS_FOR_SQL_AND_CPP(id, id);
+    using value_type = std::int64_t;
+    static constexpr auto can_be_null = false;
+    static constexpr auto has_default_value = false;
+    static constexpr auto has_auto_increment = false;
+  };
+
+  using _columns = ::sqlpp::type_vector<Id>;
+};
+inline constexpr auto tabKey = ::sqlpp::table_t<TabKey>{};
+
+struct TabLabel : public ::sqlpp::spec_base {
+  SQLPP_NAME_TAGS_FOR_SQL_AND_CPP(tab_label, tabLabel);
+
+  struct Id : public ::sqlpp::spec_base {
+    SQLPP_NAME_TAGS_FOR_SQL_AND_CPP(id, id);
+    using value_type = std::int64_t;
+    static constexpr auto can_be_null = false;
+    static constexpr auto has_default_value = false;
+    static constexpr auto has_auto_increment = false;
+  };
+
+  struct Label : public ::sqlpp::spec_base {
+    SQLPP_NAME_TAGS_FOR_SQL_AND_CPP(label, label);
+    using value_type = ::sqlpp::text;
+    static constexpr auto can_be_null = true;
+    static constexpr auto has_default_value = false;
+    static constexpr auto has_auto_increment = false;
+  };
+
+  using _columns = ::sqlpp::type_vector<Id, Label>;
+};
+inline constexpr auto tabLabel = ::sqlpp::table_t<TabLabel>{};
+
+struct labeled_key {
+  std::int64_t id;
+  std::string label;
+};
+
+using ::sqlpp::test::expect;
+}  // namespace
+
+int main() {
+  try {
+    const auto config = ::sqlpp::sqlite3::test::get_config();
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+    db(drop_table(tabPerson));
+    db(create_table(tabPerson));
+    for (auto i = 1; i <= 10; ++i) {
+      db(insert_into(tabPerson).set(tabPerson.id = i,
+                                    tabPerson.name = "person " +
+                                                     std::to_string(i),
+                                    tabPerson.isManager = false));
+    }
+
+    // A range of plain values as a single column table
+    {
+      const auto keys = std::vector<std::int64_t>{2, 4, 6, 42};
+      const auto key_table = db.register_range_table(tabKey, keys);
+
+      auto ids = std::vector<std::int64_t>{};
+      for (const auto& row :
+           db(select(tabPerson.id)
+                  .from(tabPerson.join(tabKey).on(tabPerson.id == tabKey.id))
+                  .unconditionally())) {
+        ids.push_back(row.id);
+      }
+      std::sort(ids.begin(), ids.end());
+      expect(ids == std::vector<std::int64_t>{2, 4, 6},
+             "unexpected ids of joined rows");
+    }
+
+    // The table is gone with its handle
+    try {
+      db(select(tabKey.id).from(tabKey).unconditionally());
+      throw std::logic_error("range table has not been unregistered");
+    } catch (const ::sqlpp::exception&) {
+    }
+
+    // A range of structs, projected to tuples of references and temporaries
+    {
+      const auto labels = std::vector<labeled_key>{{3, "three"}, {5, "five"}};
+      const auto label_table = db.register_range_table(
+          tabLabel, labels, [](const labeled_key& key) {
+            return std::tuple<std::int64_t, const std::string&>(key.id,
+                                                                key.label);
+          });
+
+      auto found = std::vector<std::string>{};
+      for (const auto& row :
+           db(select(tabPerson.name, tabLabel.label)
+                  .from(tabPerson.join(tabLabel).on(tabPerson.id ==
+                                                    tabLabel.id))
+                  .unconditionally())) {
+        found.push_back(std::string(row.name) + ": " +
+                        std::string(*row.label));
+      }
+      std::sort(found.begin(), found.end());
+      expect(found == std::vector<std::string>{"person 3: three",
+                                               "person 5: five"},
+             "unexpected labels of joined rows");
+
+      const auto upper_table = db.register_range_table(
+          tabKey, labels,
+          [](const labeled_key& key) { return key.id * 100; });
+      auto count = 0;
+      for (const auto& row :
+           db(select(tabKey.id).from(tabKey).unconditionally())) {
+        expect(row.id % 100 == 0, "unexpected projected value");
+        ++count;
+      }
+      expect(count == 2, "unexpected number of rows");
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,136 @@
+/*
+Copyright (c) 2018 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/sqlite3/connection.h>
+#include <sqlpp20/sqlite3/connection_pool.h>
+#include <sqlpp20/sqlite3_test/get_config.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabDepartment.h>
+
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+using test::tabDepartment;
+
+using ::sqlpp::test::expect;
+}  // namespace
+
+int main() {
+  try {
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.statement_cache_capacity = 2;
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::allowed>{config};
+    db(drop_table(tabDepartment));
+    db(create_table(tabDepartment));
+
+    const auto misses = db.statement_cache_statistics().misses;
+    for (auto i = 0; i < 10; ++i) {
+      db(insert_into(tabDepartment).set(tabDepartment.name = "hansi"));
+    }
+    auto statistics = db.statement_cache_statistics();
+    expect(statistics.misses == misses + 1, "unexpected misses for insert");
+    expect(statistics.hits >= 9, "unexpected hits for insert");
+
+    const auto select_all =
+        select(tabDepartment.id).from(tabDepartment).unconditionally();
+
+    // A statement is taken out of the cache while its result is alive
+    {
+      auto outer = 0;
+      for ([[maybe_unused]] const auto& row : db(select_all)) {
+        auto inner = 0;
+        for ([[maybe_unused]] const auto& inner_row : db(select_all)) {
+          ++inner;
+        }
+        expect(inner == 10, "unexpected number of inner rows");
+        ++outer;
+      }
+      expect(outer == 10, "unexpected number of outer rows");
+    }
+
+    // Statements are reset when they go back into the cache, so the
+    // unfinished select does not keep the table locked
+    {
+      auto result = db(select_all);
+      expect(not result.empty(), "unexpected empty result");
+    }
+    db(drop_table(tabDepartment));
+    db(create_table(tabDepartment));
+
+    // The cache is bounded
+    statistics = db.statement_cache_statistics();
+    expect(statistics.size <= 2, "unexpected cache size");
+
+    // Pooled connections keep their cached statements across checkouts
+    {
+      auto pool = ::sqlpp::sqlite3::connection_pool_t<::sqlpp::debug::none>{
+          1, config};
+      {
+        auto connection = pool.get();
+        connection(select_all);
+      }
+      auto connection = pool.get();
+      const auto before = connection.statement_cache_statistics();
+      connection(select_all);
+      const auto after = connection.statement_cache_statistics();
+      expect(after.misses == before.misses and after.hits == before.hits + 1,
+             "cached statement lost with checkout");
+    }
+
+    // Results that outlive their pooled connection do not return their
+    // statement to the cache of the handle's next user
+    {
+      auto pool = ::sqlpp::sqlite3::connection_pool_t<::sqlpp::debug::none>{
+          1, config};
+      auto result = [&pool, &select_all] {
+        auto connection = pool.get();
+        return connection(select_all);
+      }();
+      auto connection = pool.get();
+      const auto size = connection.statement_cache_statistics().size;
+      result = {};
+      expect(connection.statement_cache_statistics().size == size,
+             "statement of outliving result has been cached");
+    }
+
+    // Without capacity, there is no cache
+    config.statement_cache_capacity = 0;
+    auto uncached_db =
+        ::sqlpp::sqlite3::connection_t<::sqlpp::debug::allowed>{config};
+    uncached_db(select_all);
+    expect(uncached_db.statement_cache_statistics().misses == 0,
+           "unexpected use of statement cache");
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -0,0 +1,138 @@
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/parameter.h>
+#include <sqlpp20/sqlite3/connection.h>
+#include <sqlpp20/sqlite3/connection_pool.h>
+#include <sqlpp20/sqlite3_test/get_config.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+using test::tabPerson;
+
+using ::sqlpp::test::expect;
+
+template <typename Statistics>
+auto find(const Statistics& statistics, std::string_view prefix) {
+  for (const auto& entry : statistics) {
+    if (entry.sql.starts_with(prefix)) return entry;
+  }
+  throw std::runtime_error("missing statistics for " + std::string(prefix));
+}
+}  // namespace
+
+int main() {
+  try {
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.debug = {};
+    config.collect_statement_statistics = true;
+    // Statements that differ in their literals only share their SQL text
+    config.parameterize_literals = true;
+    auto db = ::sqlpp::sqlite3::connection_t<::sqlpp::debug::none>{config};
+    db(drop_table(tabPerson));
+    db(create_table(tabPerson));
+    for (auto i = 0; i < 20; ++i) {
+      db(insert_into(tabPerson).set(tabPerson.name = "person",
+                                    tabPerson.isManager = (i % 2 == 0)));
+    }
+
+    // Selects are recorded once their rows have been read
+    for (auto k = 0; k < 3; ++k) {
+      auto count = 0;
+      for ([[maybe_unused]] const auto& row :
+           db(select(tabPerson.id)
+                  .from(tabPerson)
+                  .where(tabPerson.isManager == true)
+                  .order_by(tabPerson.name.asc()))) {
+        ++count;
+      }
+      expect(count == 10, "unexpected number of rows");
+    }
+
+    // Prepared statements are recorded per execution
+    auto prepared = db.prepare(select(tabPerson.id)
+                                   .from(tabPerson)
+                                   .where(tabPerson.id ==
+                                          ::sqlpp::parameter<std::int64_t>(tabPerson.id)));
+    for (auto id = 1; id <= 4; ++id) {
+      prepared.parameters.id = id;
+      for ([[maybe_unused]] const auto& row : execute(prepared)) {
+      }
+    }
+
+    const auto statistics = db.statement_statistics();
+    expect(statistics.size() >= 3, "unexpected number of statements");
+
+    const auto inserts = find(statistics, "INSERT INTO tab_person");
+    expect(inserts.executions == 20, "unexpected number of inserts");
+    expect(inserts.vm_steps > 0, "missing vm steps");
+    expect(inserts.max_duration <= inserts.total_duration,
+           "unexpected durations");
+
+    const auto scans =
+        find(statistics, "SELECT tab_person.id FROM tab_person WHERE "
+                         "tab_person.is_manager");
+    expect(scans.executions == 3, "unexpected number of scans");
+    expect(scans.fullscan_steps >= 3 * 19, "missing full scan steps");
+    expect(scans.sorts == 3, "unexpected number of sorts");
+    expect(scans.max_memory_used > 0, "missing memory use");
+
+    const auto lookups = find(
+        statistics, "SELECT tab_person.id FROM tab_person WHERE tab_person.id");
+    expect(lookups.executions == 4, "unexpected number of lookups");
+    expect(lookups.fullscan_steps == 0, "lookups should not scan");
+
+    // Pooled connections keep their statistics across checkouts
+    {
+      auto pool = ::sqlpp::sqlite3::connection_pool_t<::sqlpp::debug::none>{
+          1, config};
+      for (auto k = 0; k < 3; ++k) {
+        auto connection = pool.get();
+        connection(insert_into(tabPerson).set(tabPerson.name = "pooled",
+                                              tabPerson.isManager = false));
+      }
+      auto connection = pool.get();
+      expect(find(connection.statement_statistics(), "INSERT INTO tab_person")
+                     .executions == 3,
+             "statistics lost with checkout");
+    }
+
+    db.reset_statement_statistics();
+    expect(db.statement_statistics().empty(), "statistics have not been reset");
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
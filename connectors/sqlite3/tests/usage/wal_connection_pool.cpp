@@ -0,0 +1,152 @@
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/create_table.h>
+#include <sqlpp20/clause/drop_table.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/function.h>
+#include <sqlpp20/sqlite3/wal_connection_pool.h>
+#include <sqlpp20/sqlite3_test/get_config.h>
+#include <sqlpp20_test/expect.h>
+#include <sqlpp20_test/tables/TabDepartment.h>
+
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+using test::tabDepartment;
+
+SQLPP_CREATE_NAME_TAG(rowCount);
+
+template <typename Pool>
+auto count_rows(Pool& pool) -> std::int64_t {
+  for (const auto& row :
+       pool(select(::sqlpp::count(::sqlpp::asterisk).as(rowCount))
+                .from(tabDepartment)
+                .unconditionally())) {
+    return row.rowCount;
+  }
+  throw std::runtime_error("missing row count");
+}
+
+using ::sqlpp::test::expect;
+}  // namespace
+
+int main() {
+  try {
+    auto config = ::sqlpp::sqlite3::test::get_config();
+    config.path_to_database = "sqlpp20_test_wal";
+    config.debug = {};
+    auto pool =
+        ::sqlpp::sqlite3::wal_connection_pool_t<::sqlpp::debug::allowed>{
+            4, config};
+
+    {
+      auto writer = pool.writer();
+      (*writer)(drop_table(tabDepartment));
+      (*writer)(create_table(tabDepartment));
+    }
+
+    // Statements are routed to the writer or a reader by their result type
+    pool(insert_into(tabDepartment).default_values());
+    expect(count_rows(pool) == 1, "unexpected row count");
+
+    // Readers cannot write
+    try {
+      auto reader = pool.reader();
+      reader(insert_into(tabDepartment).default_values());
+      throw std::logic_error("reader has been able to write");
+    } catch (const ::sqlpp::exception&) {
+    }
+
+    // Results keep their readers until they are destroyed, all readers can
+    // be in use at the same time
+    for (auto i = 0; i < 2; ++i) {
+      const auto select_all =
+          select(tabDepartment.id).from(tabDepartment).unconditionally();
+      auto first = pool(select_all);
+      auto second = pool(select_all);
+      auto third = pool(select_all);
+      auto fourth = pool(select_all);
+      expect(not first.empty() and not fourth.empty(), "missing rows");
+    }
+    expect(count_rows(pool) == 1, "unexpected row count");
+
+    if (not sqlite3_threadsafe()) {
+      std::clog << "sqlite3 not compiled with thread safety.\n";
+      std::clog << "Not running multi-threaded tests.\n";
+      return 0;
+    }
+
+    // Readers run concurrently with each other and with the writer, without
+    // running into SQLITE_BUSY
+    constexpr auto writer_count = 4;
+    constexpr auto reader_count = 8;
+    constexpr auto inserts_per_writer = 50;
+    auto failed = std::atomic<bool>{false};
+    auto threads = std::vector<std::thread>{};
+    for (auto i = 0; i < writer_count; ++i) {
+      threads.emplace_back([&] {
+        try {
+          for (auto k = 0; k < inserts_per_writer; ++k) {
+            pool(insert_into(tabDepartment).default_values());
+          }
+        } catch (const std::exception& e) {
+          std::cerr << "Writer exception: " << e.what() << std::endl;
+          failed = true;
+        }
+      });
+    }
+    for (auto i = 0; i < reader_count; ++i) {
+      threads.emplace_back([&] {
+        try {
+          auto last = std::int64_t{0};
+          for (auto k = 0; k < 50; ++k) {
+            const auto rows = count_rows(pool);
+            if (rows < last) throw std::logic_error("row count decreased");
+            last = rows;
+          }
+        } catch (const std::exception& e) {
+          std::cerr << "Reader exception: " << e.what() << std::endl;
+          failed = true;
+        }
+      });
+    }
+    for (auto&& t : threads) {
+      t.join();
+    }
+    expect(not failed, "concurrent access failed");
+    expect(count_rows(pool) == 1 + writer_count * inserts_per_writer,
+           "unexpected row count after concurrent inserts");
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -26,7 +26,9 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/operator/as.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_string.h>
 #include <sqlpp20/type_traits.h>
 
@@ -58,11 +60,24 @@ template <typename FunctionSpec, typename Expression>
 constexpr auto is_aggregate_v<aggregate_t<FunctionSpec, Expression>> = true;
 
 template <typename Context, typename FunctionSpec, typename Expression>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const aggregate_t<FunctionSpec, Expression>& t) {
-  return std::string(FunctionSpec::name) + "(" +
-         to_sql_string(context, typename FunctionSpec::flag_type{}) +
-         to_sql_string(context, t._expression) + ")";
+constexpr auto serialize(Context& context, std::string& sql,
+                         const aggregate_t<FunctionSpec, Expression>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += FunctionSpec::name;
+  sql += "(";
+  serialize(context, sql, typename FunctionSpec::flag_type{});
+  serialize(context, sql, t._expression);
+  sql += ")";
+}
+
+template <typename Context, typename FunctionSpec, typename Expression>
+auto sql_length_estimate(const Context& context,
+                         const aggregate_t<FunctionSpec, Expression>& t)
+    -> std::size_t {
+  return std::string_view{FunctionSpec::name}.size() + 1 +
+         sql_length_estimate(context, typename FunctionSpec::flag_type{}) +
+         sql_length_estimate(context, t._expression) + 1;
 }
 
 }  // namespace sqlpp
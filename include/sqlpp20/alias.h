@@ -27,6 +27,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/char_sequence.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_string.h>
 #include <sqlpp20/type_traits.h>
 
@@ -60,9 +62,19 @@ template <typename Expression, typename NameTag>
 constexpr auto is_alias_v<alias_t<Expression, NameTag>> = true;
 
 template <typename Context, typename Expression, typename NameTag>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const alias_t<Expression, NameTag>& t) {
-  return to_sql_string(context, t._expression) + " AS " +
-         to_sql_name(context, t);
+constexpr auto serialize(Context& context, std::string& sql,
+                         const alias_t<Expression, NameTag>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  serialize(context, sql, t._expression);
+  sql += " AS ";
+  sql += to_sql_name(context, t);
+}
+
+template <typename Context, typename Expression, typename NameTag>
+auto sql_length_estimate(const Context& context,
+                         const alias_t<Expression, NameTag>& t)
+    -> std::size_t {
+  return sql_length_estimate(context, t._expression) + sql_length(" AS ") +
+         to_sql_name(context, t).size();
 }
 }  // namespace sqlpp
@@ -26,6 +26,8 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_string.h>
 #include <sqlpp20/type_traits.h>
 
@@ -58,16 +60,35 @@ template <typename L, typename Operator, typename R>
 constexpr auto requires_braces_v<binary_t<L, Operator, R>> = true;
 
 template <typename Context, typename L, typename Operator, typename R>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const binary_t<L, Operator, R>& t) {
-  return to_sql_string(context, embrace(t._l)) + Operator::symbol +
-         to_sql_string(context, embrace(t._r));
+constexpr auto serialize(Context& context, std::string& sql,
+                         const binary_t<L, Operator, R>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  serialize(context, sql, embrace(t._l));
+  sql += Operator::symbol;
+  serialize(context, sql, embrace(t._r));
+}
+
+template <typename Context, typename L, typename Operator, typename R>
+auto sql_length_estimate(const Context& context,
+                         const binary_t<L, Operator, R>& t) -> std::size_t {
+  return sql_length_estimate(context, embrace(t._l)) +
+         std::string_view{Operator::symbol}.size() +
+         sql_length_estimate(context, embrace(t._r));
+}
+
+template <typename Context, typename Operator, typename R>
+constexpr auto serialize(Context& context, std::string& sql,
+                         const binary_t<none_t, Operator, R>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += Operator::symbol;
+  serialize(context, sql, embrace(t._r));
 }
 
 template <typename Context, typename Operator, typename R>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const binary_t<none_t, Operator, R>& t) {
-  return Operator::symbol + to_sql_string(context, embrace(t._r));
+auto sql_length_estimate(const Context& context,
+                         const binary_t<none_t, Operator, R>& t) -> std::size_t {
+  return std::string_view{Operator::symbol}.size() +
+         sql_length_estimate(context, embrace(t._r));
 }
 
 }  // namespace sqlpp
@@ -27,7 +27,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/bad_expression.h>
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/embrace.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/tuple_to_sql_string.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
@@ -97,23 +99,54 @@ struct value_type_of<when_then_t<When, Then>> {
 };
 
 template <typename Context, typename When, typename Then>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const when_then_t<When, Then>& t) {
-  return std::string{" WHEN "} + to_sql_string(context, embrace(t._when)) +
-         " THEN " + to_sql_string(context, embrace(t._then));
+constexpr auto serialize(Context& context, std::string& sql,
+                         const when_then_t<When, Then>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += " WHEN ";
+  serialize(context, sql, embrace(t._when));
+  sql += " THEN ";
+  serialize(context, sql, embrace(t._then));
+}
+
+template <typename Context, typename When, typename Then>
+auto sql_length_estimate(const Context& context,
+                         const when_then_t<When, Then>& t) -> std::size_t {
+  return sql_length(" WHEN ") + sql_length_estimate(context, embrace(t._when)) +
+         sql_length(" THEN ") + sql_length_estimate(context, embrace(t._then));
 }
 
 template <typename Context, typename... WhenThens>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const case_when_then_t<WhenThens...>& t) {
-  return std::string{" CASE"} + tuple_to_sql_string(context, "", t._when_thens);
+constexpr auto serialize(Context& context, std::string& sql,
+                         const case_when_then_t<WhenThens...>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += " CASE";
+  serialize_tuple(context, sql, "", t._when_thens);
+}
+
+template <typename Context, typename... WhenThens>
+auto sql_length_estimate(const Context& context,
+                         const case_when_then_t<WhenThens...>& t)
+    -> std::size_t {
+  return sql_length(" CASE") +
+         sql_length_estimate_tuple(context, "", t._when_thens);
+}
+
+template <typename Context, typename CaseWhenThen, typename Else>
+constexpr auto serialize(Context& context, std::string& sql,
+                         const case_when_then_else_t<CaseWhenThen, Else>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  serialize(context, sql, t._case_when_then);
+  sql += " ELSE ";
+  serialize(context, sql, embrace(t._else));
 }
 
 template <typename Context, typename CaseWhenThen, typename Else>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const case_when_then_else_t<CaseWhenThen, Else>& t) {
-  return to_sql_string(context, t._case_when_then) + " ELSE " +
-         to_sql_string(context, embrace(t._else));
+auto sql_length_estimate(const Context& context,
+                         const case_when_then_else_t<CaseWhenThen, Else>& t)
+    -> std::size_t {
+  return sql_length_estimate(context, t._case_when_then) +
+         sql_length(" ELSE ") + sql_length_estimate(context, embrace(t._else));
 }
 
 template <Expression Then>
@@ -0,0 +1,136 @@
+#pragma once
+
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/insert_values.h>
+#include <sqlpp20/statement.h>
+#include <sqlpp20/transaction.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace sqlpp {
+// Limits for each statement of a chunked multi-row insert. Connections
+// provide server specific values via insert_chunk_limits().
+struct insert_chunk_limits_t {
+  // Upper bound for sql_length_estimate() of a statement. Escaping can make
+  // the actual text up to twice as long, so connectors use half of the
+  // server's maximum.
+  std::size_t max_sql_length = std::numeric_limits<std::size_t>::max();
+  // Upper bound for the number of values per statement. Connections only
+  // set it, if they send literals as parameters.
+  std::size_t max_parameters = std::numeric_limits<std::size_t>::max();
+};
+
+template <typename InsertId>
+struct chunked_insert_result_t {
+  // The sum of the affected rows reported by the connection for each chunk,
+  // i.e. without rows skipped by the statement (e.g. INSERT OR IGNORE)
+  std::size_t affected_rows = 0;
+  // The insert id reported by the connection for each chunk, in order
+  std::vector<InsertId> insert_ids;
+};
+
+namespace detail {
+template <typename Db, typename Statement, typename... Assignments>
+auto execute_chunked(
+    Db& db,
+    clause_base<insert_multi_values_t<Assignments...>, Statement>& clause,
+    const insert_chunk_limits_t& limits) {
+  // Only the row-less statement is copied, chunks refer to the moved rows.
+  const auto rows = std::move(clause._rows);
+  auto chunk =
+      new_statement(clause, insert_multi_values_view_t<Assignments...>{});
+  auto& chunk_rows =
+      static_cast<clause_base<insert_multi_values_view_t<Assignments...>,
+                              decltype(chunk)>&>(chunk)
+          ._rows;
+
+  using _insert_id_t = decltype(db(chunk));
+  auto result = chunked_insert_result_t<_insert_id_t>{};
+  if (rows.empty()) {
+    return result;
+  }
+
+  const auto context = typename Db::context_type{};
+  const auto base_length = sql_length_estimate(context, chunk);
+  const auto max_rows_by_parameters =
+      std::max(std::size_t{1}, limits.max_parameters / sizeof...(Assignments));
+
+  const auto all_rows = std::span{rows};
+  const auto execute_chunk = [&](decltype(all_rows) chunk_span) {
+    chunk_rows = chunk_span;
+    result.insert_ids.push_back(db(chunk));
+    result.affected_rows += static_cast<std::size_t>(db.affected_rows());
+  };
+
+  auto transaction = std::optional<transaction_t<Db>>{};
+  auto first = std::size_t{0};
+  auto length = base_length;
+  for (auto i = std::size_t{0}; i < all_rows.size(); ++i) {
+    const auto row_length =
+        sql_length_estimate_multi_values_row(context, all_rows[i]);
+    if (i > first and (length + row_length > limits.max_sql_length or
+                       i - first == max_rows_by_parameters)) {
+      // Chunks become part of a transaction opened by the caller
+      if (not transaction and not db.is_transaction_active()) {
+        transaction.emplace(db);
+      }
+      execute_chunk(all_rows.subspan(first, i - first));
+      first = i;
+      length = base_length;
+    }
+    length += row_length;
+  }
+  execute_chunk(all_rows.subspan(first));
+
+  if (transaction) {
+    transaction->commit();
+  }
+  return result;
+}
+}  // namespace detail
+
+// Executes a multi-row insert as a series of statements that stay within
+// the given limits. Several statements are executed in a single transaction,
+// unless there is an active transaction already.
+template <typename Db, typename... Clauses>
+auto execute_chunked(Db& db, statement<Clauses...> s,
+                     const insert_chunk_limits_t& limits) {
+  return detail::execute_chunked(db, s, limits);
+}
+
+template <typename Db, typename... Clauses>
+auto execute_chunked(Db& db, statement<Clauses...> s) {
+  return execute_chunked(db, std::move(s), db.insert_chunk_limits());
+}
+}  // namespace sqlpp
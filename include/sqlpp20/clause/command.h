@@ -29,6 +29,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlpp20/clause/from.h>
 #include <sqlpp20/clause/where.h>
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_name.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrong.h>
@@ -50,10 +52,10 @@ template <typename Statement>
 class clause_base<command_t, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<command_t, OtherStatement>& t)
+  constexpr clause_base(const clause_base<command_t, OtherStatement>& t)
       : _command(t._comand) {}
 
-  clause_base(std::string command) : _command(command) {}
+  constexpr clause_base(std::string command) : _command(command) {}
 
   std::string _command;
 };
@@ -67,9 +69,17 @@ struct clause_result_type<command_t> {
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const clause_base<command_t, Statement>& t) {
-  return t._command;
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<command_t, Statement>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += t._command;
+}
+
+template <typename Context, typename Statement>
+auto sql_length_estimate(const Context&,
+                         const clause_base<command_t, Statement>& t)
+    -> std::size_t {
+  return t._command.size();
 }
 
 [[nodiscard]] auto command(std::string command) {
@@ -27,6 +27,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
@@ -51,10 +52,11 @@ template <typename Tab, typename Statement>
 class clause_base<create_table_t<Tab>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<create_table_t<Tab>, OtherStatement>& t)
+  constexpr clause_base(
+      const clause_base<create_table_t<Tab>, OtherStatement>& t)
       : _table(t.table) {}
 
-  clause_base(Tab table) : _table(table) {}
+  constexpr clause_base(Tab table) : _table(table) {}
 
   Tab _table;
 };
@@ -68,10 +70,12 @@ struct clause_result_type<create_table_t<Tab>> {
 };
 
 template <typename Context, typename Tab, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<create_table_t<Tab>, Statement>& t) {
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<create_table_t<Tab>, Statement>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
   static_assert(wrong<Context, clause_base<create_table_t<Tab>, Statement>>,
-                "Missing specialization for to_sql_string() for the current "
+                "Missing specialization for serialize() for the current "
                 "connection type");
 }
 
@@ -29,6 +29,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlpp20/clause/from.h>
 #include <sqlpp20/clause/where.h>
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/type_traits.h>
 
 namespace sqlpp {
@@ -48,10 +50,11 @@ template <typename Tab, typename Statement>
 class clause_base<delete_from_t<Tab>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<delete_from_t<Tab>, OtherStatement>& t)
+  constexpr clause_base(
+      const clause_base<delete_from_t<Tab>, OtherStatement>& t)
       : _table(t._table) {}
 
-  clause_base(Tab tab) : _table(tab) {}
+  constexpr clause_base(Tab tab) : _table(tab) {}
 
   Tab _table;
 };
@@ -65,9 +68,19 @@ struct clause_result_type<delete_from_t<Tab>> {
 };
 
 template <typename Context, typename Tab, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<delete_from_t<Tab>, Statement>& t) {
-  return std::string{"DELETE FROM "} + to_sql_string(context, t._table);
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<delete_from_t<Tab>, Statement>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += "DELETE FROM ";
+  serialize(context, sql, t._table);
+}
+
+template <typename Context, typename Tab, typename Statement>
+auto sql_length_estimate(const Context& context,
+                         const clause_base<delete_from_t<Tab>, Statement>& t)
+    -> std::size_t {
+  return sql_length("DELETE FROM ") + sql_length_estimate(context, t._table);
 }
 
 template <PrimaryTable Tab>
@@ -29,6 +29,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlpp20/clause/from.h>
 #include <sqlpp20/clause/where.h>
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_name.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrong.h>
@@ -52,10 +54,10 @@ template <typename Tab, typename Statement>
 class clause_base<drop_table_t<Tab>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<drop_table_t<Tab>, OtherStatement>& t)
+  constexpr clause_base(const clause_base<drop_table_t<Tab>, OtherStatement>& t)
       : _table(t.table) {}
 
-  clause_base(Tab table) : _table(table) {}
+  constexpr clause_base(Tab table) : _table(table) {}
 
   Tab _table;
 };
@@ -69,9 +71,20 @@ struct clause_result_type<drop_table_t<Tab>> {
 };
 
 template <typename Context, typename Tab, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<drop_table_t<Tab>, Statement>& t) {
-  return std::string("DROP TABLE IF EXISTS ") + to_sql_name(context, t._table);
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<drop_table_t<Tab>, Statement>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += "DROP TABLE IF EXISTS ";
+  sql += to_sql_name(context, t._table);
+}
+
+template <typename Context, typename Tab, typename Statement>
+auto sql_length_estimate(const Context& context,
+                         const clause_base<drop_table_t<Tab>, Statement>& t)
+    -> std::size_t {
+  return sql_length("DROP TABLE IF EXISTS ") +
+         to_sql_name(context, t._table).size();
 }
 
 template <Table Tab>
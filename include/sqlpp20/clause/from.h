@@ -27,6 +27,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
@@ -51,18 +53,27 @@ template <typename Tab, typename Statement>
 class clause_base<from_t<Tab>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<from_t<Tab>, OtherStatement>& s)
+  constexpr clause_base(const clause_base<from_t<Tab>, OtherStatement>& s)
       : _table(s._table) {}
 
-  clause_base(const from_t<Tab>& f) : _table(f._table) {}
+  constexpr clause_base(const from_t<Tab>& f) : _table(f._table) {}
 
   Tab _table;
 };
 
 template <typename Context, typename Tab, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<from_t<Tab>, Statement>& t) {
-  return std::string(" FROM ") + to_sql_string(context, t._table);
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<from_t<Tab>, Statement>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += " FROM ";
+  serialize(context, sql, t._table);
+}
+
+template <typename Context, typename Tab, typename Statement>
+auto sql_length_estimate(const Context& context,
+                         const clause_base<from_t<Tab>, Statement>& t)
+    -> std::size_t {
+  return sql_length(" FROM ") + sql_length_estimate(context, t._table);
 }
 
 struct no_from_t {};
@@ -82,9 +93,9 @@ class clause_base<no_from_t, Statement> {
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const clause_base<no_from_t, Statement>&) {
-  return std::string{};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<no_from_t, Statement>& t) -> void {
+  detail::serialize_custom(context, sql, t);
 }
 
 template <typename Tab>
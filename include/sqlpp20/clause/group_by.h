@@ -27,6 +27,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/tuple_to_sql_string.h>
 #include <sqlpp20/type_traits.h>
@@ -57,20 +59,33 @@ template <typename... Expressions, typename Statement>
 class clause_base<group_by_t<Expressions...>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<group_by_t<Expressions...>, OtherStatement>& s)
+  constexpr clause_base(
+      const clause_base<group_by_t<Expressions...>, OtherStatement>& s)
       : _expressions(s._expressions) {}
 
-  clause_base(const group_by_t<Expressions...>& f) : _expressions(f._expressions) {}
+  constexpr clause_base(const group_by_t<Expressions...>& f)
+      : _expressions(f._expressions) {}
 
   std::tuple<Expressions...> _expressions;
 };
 
 template <typename Context, typename... Expressions, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<group_by_t<Expressions...>, Statement>& t) {
-  return std::string{" GROUP BY "} +
-         tuple_to_sql_string(context, ", ",
-                             std::tie(std::get<Expressions>(t._expressions)...));
+constexpr auto serialize(
+    Context& context, std::string& sql,
+    const clause_base<group_by_t<Expressions...>, Statement>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += " GROUP BY ";
+  serialize_tuple(context, sql, ", ",
+                  std::tie(std::get<Expressions>(t._expressions)...));
+}
+
+template <typename Context, typename Statement, typename... Expressions>
+auto sql_length_estimate(
+    const Context& context,
+    const clause_base<group_by_t<Expressions...>, Statement>& t)
+    -> std::size_t {
+  return sql_length(" GROUP BY ") +
+         sql_length_estimate_tuple(context, ", ", t._expressions);
 }
 
 struct no_group_by_t {};
@@ -94,9 +109,10 @@ class clause_base<no_group_by_t, Statement> {
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<no_group_by_t, Statement>& t) {
-  return std::string{};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<no_group_by_t, Statement>& t)
+    -> void {
+  detail::serialize_custom(context, sql, t);
 }
 
 template <Expression... Expressions>
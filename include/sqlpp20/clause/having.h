@@ -27,6 +27,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
@@ -51,10 +53,12 @@ template <typename Condition, typename Statement>
 class clause_base<having_t<Condition>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<having_t<Condition>, OtherStatement>& s)
+  constexpr clause_base(
+      const clause_base<having_t<Condition>, OtherStatement>& s)
       : _condition(s._condition) {}
 
-  clause_base(const having_t<Condition>& f) : _condition(f._condition) {}
+  constexpr clause_base(const having_t<Condition>& f)
+      : _condition(f._condition) {}
 
   Condition _condition;
 };
@@ -77,9 +81,19 @@ constexpr auto check_clause_preparable(
 }
 
 template <typename Context, typename Condition, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<having_t<Condition>, Statement>& t) {
-  return std::string(" HAVING ") + to_sql_string(context, t._condition);
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<having_t<Condition>, Statement>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += " HAVING ";
+  serialize(context, sql, t._condition);
+}
+
+template <typename Context, typename Condition, typename Statement>
+auto sql_length_estimate(const Context& context,
+                         const clause_base<having_t<Condition>, Statement>& t)
+    -> std::size_t {
+  return sql_length(" HAVING ") + sql_length_estimate(context, t._condition);
 }
 
 struct no_having_t {};
@@ -99,9 +113,9 @@ class clause_base<no_having_t, Statement> {
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const clause_base<no_having_t, Statement>&) {
-  return std::string{};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<no_having_t, Statement>& t) -> void {
+  detail::serialize_custom(context, sql, t);
 }
 
 template <BooleanExpression Condition>
@@ -28,6 +28,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <sqlpp20/clause/insert_values.h>
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
@@ -53,18 +55,29 @@ class clause_base<insert_into_t<Table>, Statement> {
   using insert_into_table_t = Table;
 
   template <typename OtherStatement>
-  clause_base(const clause_base<insert_into_t<Table>, OtherStatement>& s)
+  constexpr clause_base(
+      const clause_base<insert_into_t<Table>, OtherStatement>& s)
       : _table(s._table) {}
 
-  clause_base(Table table) : _table(table) {}
+  constexpr clause_base(Table table) : _table(table) {}
 
   Table _table;
 };
 
 template <typename Context, typename Table, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<insert_into_t<Table>, Statement>& t) {
-  return std::string("INSERT INTO ") + to_sql_string(context, t._table);
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<insert_into_t<Table>, Statement>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += "INSERT INTO ";
+  serialize(context, sql, t._table);
+}
+
+template <typename Context, typename Table, typename Statement>
+auto sql_length_estimate(const Context& context,
+                         const clause_base<insert_into_t<Table>, Statement>& t)
+    -> std::size_t {
+  return sql_length("INSERT INTO ") + sql_length_estimate(context, t._table);
 }
 
 template <typename Table>
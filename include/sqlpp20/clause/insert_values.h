@@ -29,14 +29,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlpp20/clause_fwd.h>
 #include <sqlpp20/default_value.h>
 #include <sqlpp20/detail/first.h>
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/exception.h>
 #include <sqlpp20/free_column.h>
+#include <sqlpp20/sql_length_estimate.h>
+#include <sqlpp20/sql_string_cache.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/tuple_to_sql_string.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/type_vector_is_subset_of.h>
 #include <sqlpp20/wrapped_static_assert.h>
 
+#include <span>
 #include <tuple>
 #include <vector>
 
@@ -47,16 +51,33 @@ struct insert_assignment_t {
 };
 
 template <typename Context, typename Assignment>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const insert_assignment_t<Assignment>& assignment) {
+constexpr auto serialize(Context& context, std::string& sql,
+                         const insert_assignment_t<Assignment>& assignment)
+    -> void {
+  if (detail::serialize_custom(context, sql, assignment)) return;
   if constexpr (::sqlpp::is_optional_v<Assignment>) {
     if (assignment._assignment) {
-      return to_sql_string(context, assignment._assignment.value().value);
+      serialize(context, sql, assignment._assignment.value().value);
     } else {
-      return to_sql_string(context, ::sqlpp::default_value);
+      serialize(context, sql, ::sqlpp::default_value);
     }
   } else {
-    return to_sql_string(context, assignment._assignment.value);
+    serialize(context, sql, assignment._assignment.value);
+  }
+}
+
+template <typename Context, typename Assignment>
+auto sql_length_estimate(const Context& context,
+                         const insert_assignment_t<Assignment>& assignment)
+    -> std::size_t {
+  if constexpr (::sqlpp::is_optional_v<Assignment>) {
+    if (assignment._assignment) {
+      return sql_length_estimate(context,
+                                 assignment._assignment.value().value);
+    }
+    return sql_length_estimate(context, ::sqlpp::default_value);
+  } else {
+    return sql_length_estimate(context, assignment._assignment.value);
   }
 }
 }  // namespace sqlpp
@@ -80,11 +101,11 @@ template <typename Statement, typename... Assignments>
 class clause_base<insert_values_t<Assignments...>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(
+  constexpr clause_base(
       const clause_base<insert_values_t<Assignments...>, OtherStatement>& s)
       : _assignments(s._assignments) {}
 
-  clause_base(const insert_values_t<Assignments...>& f)
+  constexpr clause_base(const insert_values_t<Assignments...>& f)
       : _assignments(f._assignments) {}
 
   std::tuple<Assignments...> _assignments;
@@ -106,6 +127,18 @@ constexpr auto some_elements_of_L_do_not_match_P(::sqlpp::type_vector<Ls...>,
                                                  Pred) -> bool {
   return (false or ... or (not Pred::template value<Ls>));
 }
+
+// The values of one row, e.g. "(?, ?)"
+template <typename Context, typename... Assignments>
+constexpr auto serialize_values_row(Context& context, std::string& sql,
+                                    const std::tuple<Assignments...>& row)
+    -> void {
+  sql += "(";
+  serialize_tuple(context, sql, ", ",
+                  std::tuple(insert_assignment_t<Assignments>{
+                      std::get<Assignments>(row)}...));
+  sql += ")";
+}
 }  // namespace detail
 
 template <typename Db, typename Statement, typename... Assignments>
@@ -125,30 +158,43 @@ constexpr auto check_clause_preparable(
 }
 
 template <typename Context, typename Statement, typename... Assignments>
-[[nodiscard]] auto to_sql_string(
-    Context& context,
-    const clause_base<insert_values_t<Assignments...>, Statement>& t) {
-  auto ret = std::string{};
+constexpr auto serialize(
+    Context& context, std::string& sql,
+    const clause_base<insert_values_t<Assignments...>, Statement>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
   // columns
   {
-    ret += " (";
-    ret += tuple_to_sql_string(
-        context, ", ",
+    sql += " (";
+    serialize_tuple(
+        context, sql, ", ",
         std::tuple(
             free_column_t<column_of_t<remove_optional_t<Assignments>>>{}...));
-    ret += ")";
+    sql += ")";
   }
 
   // values
   {
-    ret += " VALUES (";
-    ret += tuple_to_sql_string(context, ", ",
-                               std::tuple(insert_assignment_t<Assignments>{
-                                   std::get<Assignments>(t._assignments)}...));
-    ret += ")";
+    sql += " VALUES ";
+    detail::serialize_values_row(context, sql, t._assignments);
   }
+}
 
-  return ret;
+template <typename Context, typename Statement, typename... Assignments>
+auto sql_length_estimate(
+    const Context& context,
+    const clause_base<insert_values_t<Assignments...>, Statement>& t)
+    -> std::size_t {
+  return sql_length(" (") +
+         sql_length_estimate_tuple(
+             context, ", ",
+             std::tuple(free_column_t<
+                        column_of_t<remove_optional_t<Assignments>>>{}...)) +
+         sql_length(") VALUES (") +
+         sql_length_estimate_tuple(
+             context, ", ",
+             std::tuple(insert_assignment_t<Assignments>{
+                 std::get<Assignments>(t._assignments)}...)) +
+         sql_length(")");
 }
 
 struct insert_default_values_t {};
@@ -161,9 +207,10 @@ template <typename Statement>
 class clause_base<insert_default_values_t, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<insert_default_values_t, OtherStatement>& s) {}
+  constexpr clause_base(
+      const clause_base<insert_default_values_t, OtherStatement>& s) {}
 
-  clause_base(const insert_default_values_t& f) {}
+  constexpr clause_base(const insert_default_values_t& f) {}
 };
 
 SQLPP_WRAPPED_STATIC_ASSERT(
@@ -184,10 +231,18 @@ constexpr auto check_clause_preparable(
 }
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context,
-    const clause_base<insert_default_values_t, Statement>& t) {
-  return std::string{" DEFAULT VALUES"};
+constexpr auto serialize(
+    Context& context, std::string& sql,
+    const clause_base<insert_default_values_t, Statement>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += " DEFAULT VALUES";
+}
+
+template <typename Context, typename Statement>
+auto sql_length_estimate(
+    const Context&, const clause_base<insert_default_values_t, Statement>&)
+    -> std::size_t {
+  return sql_length(" DEFAULT VALUES");
 }
 
 template <typename... Assignments>
@@ -195,6 +250,11 @@ struct insert_multi_values_t {
   std::vector<std::tuple<Assignments...>> _rows;
 };
 
+// The number of rows is known at runtime only
+template <typename... Assignments>
+struct detail::has_runtime_sql_text<insert_multi_values_t<Assignments...>>
+    : std::true_type {};
+
 template <typename... Assignments>
 struct nodes_of<insert_multi_values_t<Assignments...>> {
   using type = type_vector<Assignments...>;
@@ -208,11 +268,12 @@ template <typename Statement, typename... Assignments>
 class clause_base<insert_multi_values_t<Assignments...>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<insert_multi_values_t<Assignments...>,
-                                OtherStatement>& s)
+  constexpr clause_base(
+      const clause_base<insert_multi_values_t<Assignments...>,
+                        OtherStatement>& s)
       : _rows(s._rows) {}
 
-  clause_base(const insert_multi_values_t<Assignments...>& f)
+  constexpr clause_base(const insert_multi_values_t<Assignments...>& f)
       : _rows(f._rows) {}
 
   std::vector<std::tuple<Assignments...>> _rows;
@@ -226,40 +287,143 @@ constexpr auto check_clause_preparable(
       type_t<clause_base<insert_values_t<Assignments...>, Statement>>{});
 }
 
+namespace detail {
 // this function assumes that there is something to do
 // the _check if there is at least one row has to be performed elsewhere
-template <typename Context, typename Statement, typename... Assignments>
-[[nodiscard]] auto to_sql_string(
-    Context& context,
-    const clause_base<insert_multi_values_t<Assignments...>, Statement>& t) {
-  auto ret = std::string{};
-
+template <typename Context, typename... Assignments>
+constexpr auto serialize_multi_values(
+    Context& context, std::string& sql,
+    std::span<const std::tuple<Assignments...>> rows) -> void {
   // columns
   {
-    ret += " (";
-    ret += tuple_to_sql_string(
-        context, ", ",
+    sql += " (";
+    serialize_tuple(
+        context, sql, ", ",
         std::tuple(
             free_column_t<column_of_t<remove_optional_t<Assignments>>>{}...));
-    ret += ")";
+    sql += ")";
   }
 
   // values
   {
-    ret += " VALUES ";
+    sql += " VALUES ";
     auto first = true;
-    for (const auto& row : t._rows) {
-      if (!first) ret += ", ";
+    for (const auto& row : rows) {
+      if (!first) sql += ", ";
       first = false;
-      ret += "(";
-      ret += tuple_to_sql_string(context, ", ",
-                                 std::tuple(insert_assignment_t<Assignments>{
-                                     std::get<Assignments>(row)}...));
-      ret += ")";
+      serialize_values_row(context, sql, row);
     }
   }
+}
+
+// Estimated length of a row, including the separator from its predecessor
+template <typename Context, typename... Assignments>
+auto sql_length_estimate_multi_values_row(
+    const Context& context, const std::tuple<Assignments...>& row)
+    -> std::size_t {
+  return sql_length(", (") +
+         sql_length_estimate_tuple(context, ", ",
+                                   std::tuple(insert_assignment_t<Assignments>{
+                                       std::get<Assignments>(row)}...)) +
+         sql_length(")");
+}
+
+template <typename Context, typename... Assignments>
+auto sql_length_estimate_multi_values(
+    const Context& context, std::span<const std::tuple<Assignments...>> rows)
+    -> std::size_t {
+  auto length =
+      sql_length(" (") +
+      sql_length_estimate_tuple(
+          context, ", ",
+          std::tuple(
+              free_column_t<column_of_t<remove_optional_t<Assignments>>>{}...)) +
+      sql_length(") VALUES ");
+  for (const auto& row : rows) {
+    length += sql_length_estimate_multi_values_row(context, row);
+  }
+  if (not rows.empty()) {
+    length -= sql_length(", ");
+  }
+  return length;
+}
+}  // namespace detail
+
+template <typename Context, typename Statement, typename... Assignments>
+constexpr auto serialize(
+    Context& context, std::string& sql,
+    const clause_base<insert_multi_values_t<Assignments...>, Statement>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  detail::serialize_multi_values(context, sql, std::span{t._rows});
+}
+
+template <typename Context, typename Statement, typename... Assignments>
+auto sql_length_estimate(
+    const Context& context,
+    const clause_base<insert_multi_values_t<Assignments...>, Statement>& t)
+    -> std::size_t {
+  return detail::sql_length_estimate_multi_values(context, std::span{t._rows});
+}
+
+// Rows of a multi-row insert that are owned elsewhere, e.g. one chunk of an
+// insert_multi_values_t (see execute_chunked)
+template <typename... Assignments>
+struct insert_multi_values_view_t {
+  std::span<const std::tuple<Assignments...>> _rows;
+};
+
+template <typename... Assignments>
+struct detail::has_runtime_sql_text<
+    insert_multi_values_view_t<Assignments...>> : std::true_type {};
+
+template <typename... Assignments>
+struct nodes_of<insert_multi_values_view_t<Assignments...>> {
+  using type = type_vector<Assignments...>;
+};
+
+template <typename... Assignments>
+constexpr auto clause_tag<insert_multi_values_view_t<Assignments...>> =
+    ::std::string_view{"insert_values"};
 
-  return ret;
+template <typename Statement, typename... Assignments>
+class clause_base<insert_multi_values_view_t<Assignments...>, Statement> {
+ public:
+  template <typename OtherStatement>
+  constexpr clause_base(
+      const clause_base<insert_multi_values_view_t<Assignments...>,
+                        OtherStatement>& s)
+      : _rows(s._rows) {}
+
+  constexpr clause_base(const insert_multi_values_view_t<Assignments...>& f)
+      : _rows(f._rows) {}
+
+  std::span<const std::tuple<Assignments...>> _rows;
+};
+
+template <typename Db, typename Statement, typename... Assignments>
+constexpr auto check_clause_preparable(
+    const type_t<
+        clause_base<insert_multi_values_view_t<Assignments...>, Statement>>&) {
+  return check_clause_preparable<Db>(
+      type_t<clause_base<insert_values_t<Assignments...>, Statement>>{});
+}
+
+template <typename Context, typename Statement, typename... Assignments>
+constexpr auto serialize(
+    Context& context, std::string& sql,
+    const clause_base<insert_multi_values_view_t<Assignments...>, Statement>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  detail::serialize_multi_values(context, sql, t._rows);
+}
+
+template <typename Context, typename Statement, typename... Assignments>
+auto sql_length_estimate(
+    const Context& context,
+    const clause_base<insert_multi_values_view_t<Assignments...>, Statement>& t)
+    -> std::size_t {
+  return detail::sql_length_estimate_multi_values(context, t._rows);
 }
 
 #warning: Assignments need to prevent read-only
@@ -296,8 +460,9 @@ class clause_base<no_insert_values_t, Statement> {
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 clause_base<no_insert_values_t, Statement>&) {
-  return std::string{};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<no_insert_values_t, Statement>& t)
+    -> void {
+  detail::serialize_custom(context, sql, t);
 }
 }  // namespace sqlpp
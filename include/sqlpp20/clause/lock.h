@@ -27,6 +27,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
@@ -61,15 +63,32 @@ class clause_base<for_share_t, Statement> {
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<for_update_t, Statement>& t) {
-  return std::string(" FOR UPDATE");
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<for_update_t, Statement>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += " FOR UPDATE";
 }
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const clause_base<for_share_t, Statement>& t) {
-  return std::string(" FOR SHARE");
+auto sql_length_estimate(const Context&,
+                         const clause_base<for_update_t, Statement>&)
+    -> std::size_t {
+  return sql_length(" FOR UPDATE");
+}
+
+template <typename Context, typename Statement>
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<for_share_t, Statement>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += " FOR SHARE";
+}
+
+template <typename Context, typename Statement>
+auto sql_length_estimate(const Context&,
+                         const clause_base<for_share_t, Statement>&)
+    -> std::size_t {
+  return sql_length(" FOR SHARE");
 }
 
 struct no_lock_t {};
@@ -92,9 +111,9 @@ class clause_base<no_lock_t, Statement> {
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const clause_base<no_lock_t, Statement>&) {
-  return std::string{};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<no_lock_t, Statement>& t) -> void {
+  detail::serialize_custom(context, sql, t);
 }
 
 [[nodiscard]] constexpr auto for_update() {
@@ -27,6 +27,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
@@ -49,10 +51,10 @@ template <typename Number, typename Statement>
 class clause_base<offset_t<Number>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<offset_t<Number>, OtherStatement>& s)
+  constexpr clause_base(const clause_base<offset_t<Number>, OtherStatement>& s)
       : _number(s._number) {}
 
-  clause_base(const offset_t<Number>& f) : _number(f._number) {}
+  constexpr clause_base(const offset_t<Number>& f) : _number(f._number) {}
 
   Number _number;
 };
@@ -72,11 +74,24 @@ constexpr auto check_clause_preparable(
 }
 
 template <typename Context, typename Number, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<offset_t<Number>, Statement>& t) {
-  if (has_value(t._number)) return std::string{};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<offset_t<Number>, Statement>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  if (not has_value(t._number)) return;
+
+  sql += " OFFSET ";
+  serialize(context, sql, get_value(t._number));
+}
+
+template <typename Context, typename Number, typename Statement>
+auto sql_length_estimate(const Context& context,
+                         const clause_base<offset_t<Number>, Statement>& t)
+    -> std::size_t {
+  if (not has_value(t._number)) return 0;
 
-  return std::string{" OFFSET "} + to_sql_string(context, get_value(t._number));
+  return sql_length(" OFFSET ") +
+         sql_length_estimate(context, get_value(t._number));
 }
 
 struct no_offset_t {};
@@ -97,9 +112,9 @@ class clause_base<no_offset_t, Statement> {
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const clause_base<no_offset_t, Statement>&) {
-  return std::string{};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<no_offset_t, Statement>& t) -> void {
+  detail::serialize_custom(context, sql, t);
 }
 
 template <typename Value>
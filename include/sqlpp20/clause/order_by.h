@@ -27,6 +27,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/tuple_to_sql_string.h>
 #include <sqlpp20/type_traits.h>
@@ -54,10 +56,12 @@ template <typename... Columns, typename Statement>
 class clause_base<order_by_t<Columns...>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<order_by_t<Columns...>, OtherStatement>& s)
+  constexpr clause_base(
+      const clause_base<order_by_t<Columns...>, OtherStatement>& s)
       : _columns(s._columns) {}
 
-  clause_base(const order_by_t<Columns...>& f) : _columns(f._columns) {}
+  constexpr clause_base(const order_by_t<Columns...>& f)
+      : _columns(f._columns) {}
 
   std::tuple<Columns...> _columns;
 };
@@ -84,10 +88,20 @@ constexpr auto check_clause_preparable(
 }
 
 template <typename Context, typename... Columns, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<order_by_t<Columns...>, Statement>& t) {
-  return std::string{" ORDER BY "} +
-         tuple_to_sql_string(context, ", ", t._columns);
+constexpr auto serialize(
+    Context& context, std::string& sql,
+    const clause_base<order_by_t<Columns...>, Statement>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += " ORDER BY ";
+  serialize_tuple(context, sql, ", ", t._columns);
+}
+
+template <typename Context, typename Statement, typename... Columns>
+auto sql_length_estimate(
+    const Context& context,
+    const clause_base<order_by_t<Columns...>, Statement>& t) -> std::size_t {
+  return sql_length(" ORDER BY ") +
+         sql_length_estimate_tuple(context, ", ", t._columns);
 }
 
 struct no_order_by_t {};
@@ -108,9 +122,10 @@ class clause_base<no_order_by_t, Statement> {
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<no_order_by_t, Statement>& t) {
-  return std::string{};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<no_order_by_t, Statement>& t)
+    -> void {
+  detail::serialize_custom(context, sql, t);
 }
 
 template <OrderExpression... Expressions>
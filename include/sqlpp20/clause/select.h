@@ -37,6 +37,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlpp20/clause/select_flags.h>
 #include <sqlpp20/clause/where.h>
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/type_traits.h>
 
 namespace sqlpp {
@@ -49,15 +51,23 @@ template <typename Statement>
 class clause_base<select_t, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<select_t, OtherStatement>&) {}
+  constexpr clause_base(const clause_base<select_t, OtherStatement>&) {}
 
-  clause_base() = default;
+  constexpr clause_base() = default;
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const clause_base<select_t, Statement>& t) {
-  return std::string{"SELECT"};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<select_t, Statement>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += "SELECT";
+}
+
+template <typename Context, typename Statement>
+auto sql_length_estimate(const Context&,
+                         const clause_base<select_t, Statement>&)
+    -> std::size_t {
+  return sql_length("SELECT");
 }
 
 // select with no args or an empty tuple yields a blank select statement
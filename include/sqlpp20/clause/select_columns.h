@@ -28,8 +28,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <sqlpp20/clause_fwd.h>
 #include <sqlpp20/column_spec.h>
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/result.h>
 #include <sqlpp20/result_row.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/to_sql_name.h>
 #include <sqlpp20/tuple_to_sql_string.h>
@@ -67,24 +69,38 @@ struct select_column_t {
 };
 
 template <typename Context, typename Column>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const select_column_t<Column>& t) {
-  return has_value(t._column)
-             ? to_sql_string(context, get_value(t._column))
-             : std::string("NULL AS ") +
-                   to_sql_name(context,
-                               name_tag_of_t<remove_optional_t<Column>>{});
+constexpr auto serialize(Context& context, std::string& sql,
+                         const select_column_t<Column>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  if (has_value(t._column)) {
+    serialize(context, sql, get_value(t._column));
+  } else {
+    sql += "NULL AS ";
+    sql += to_sql_name(context, name_tag_of_t<remove_optional_t<Column>>{});
+  }
+}
+
+template <typename Context, typename Column>
+auto sql_length_estimate(const Context& context,
+                         const select_column_t<Column>& t) -> std::size_t {
+  if (has_value(t._column)) {
+    return sql_length_estimate(context, get_value(t._column));
+  }
+  return sql_length("NULL AS ") +
+         to_sql_name(context, name_tag_of_t<remove_optional_t<Column>>{})
+             .size();
 }
 
 template <typename... Columns, typename Statement>
 class clause_base<select_columns_t<Columns...>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(
+  constexpr clause_base(
       const clause_base<select_columns_t<Columns...>, OtherStatement>& s)
       : _columns(s._columns) {}
 
-  clause_base(const select_columns_t<Columns...>& f) : _columns(f._columns) {}
+  constexpr clause_base(const select_columns_t<Columns...>& f)
+      : _columns(f._columns) {}
 
   std::tuple<select_column_t<Columns>...> _columns;
 };
@@ -130,10 +146,20 @@ struct result_row_of<clause_base<select_columns_t<Columns...>, Statement>> {
 };
 
 template <typename Context, typename... Columns, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context,
-    const clause_base<select_columns_t<Columns...>, Statement>& t) {
-  return " " + tuple_to_sql_string(context, ", ", t._columns);
+constexpr auto serialize(
+    Context& context, std::string& sql,
+    const clause_base<select_columns_t<Columns...>, Statement>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += " ";
+  serialize_tuple(context, sql, ", ", t._columns);
+}
+
+template <typename Context, typename Statement, typename... Columns>
+auto sql_length_estimate(
+    const Context& context,
+    const clause_base<select_columns_t<Columns...>, Statement>& t)
+    -> std::size_t {
+  return 1 + sql_length_estimate_tuple(context, ", ", t._columns);
 }
 
 struct no_select_columns_t {};
@@ -162,9 +188,10 @@ class clause_base<no_select_columns_t, Statement> {
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<no_select_columns_t, Statement>& t) {
-  return std::string{};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<no_select_columns_t, Statement>& t)
+    -> void {
+  detail::serialize_custom(context, sql, t);
 }
 
 template <typename... Columns>
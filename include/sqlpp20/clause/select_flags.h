@@ -27,7 +27,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/result_row.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
@@ -53,20 +55,29 @@ template <typename... Flags, typename Statement>
 class clause_base<select_flags_t<Flags...>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<select_flags_t<Flags...>, OtherStatement>& s)
+  constexpr clause_base(
+      const clause_base<select_flags_t<Flags...>, OtherStatement>& s)
       : _flags(s._flags) {}
 
-  clause_base(const select_flags_t<Flags...>& f) : _flags(f._flags) {}
+  constexpr clause_base(const select_flags_t<Flags...>& f) : _flags(f._flags) {}
 
   std::tuple<Flags...> _flags;
 };
 
 template <typename Context, typename... Flags, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context,
-    const clause_base<select_flags_t<Flags...>, Statement>& t) {
-  return (std::string{} + ... +
-          to_sql_string(context, std::get<Flags>(t._flags)));
+constexpr auto serialize(
+    Context& context, std::string& sql,
+    const clause_base<select_flags_t<Flags...>, Statement>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  (serialize(context, sql, std::get<Flags>(t._flags)), ...);
+}
+
+template <typename Context, typename Statement, typename... Flags>
+auto sql_length_estimate(
+    const Context& context,
+    const clause_base<select_flags_t<Flags...>, Statement>& t)
+    -> std::size_t {
+  return sql_length_estimate_tuple(context, "", t._flags);
 }
 
 struct no_select_flags_t {};
@@ -88,9 +99,10 @@ class clause_base<no_select_flags_t, Statement> {
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<no_select_flags_t, Statement>& t) {
-  return std::string{};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<no_select_flags_t, Statement>& t)
+    -> void {
+  detail::serialize_custom(context, sql, t);
 }
 
 template <SelectFlag... Flags>
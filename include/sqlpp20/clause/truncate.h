@@ -27,6 +27,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
@@ -48,10 +50,10 @@ template <typename Tab, typename Statement>
 class clause_base<truncate_t<Tab>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<truncate_t<Tab>, OtherStatement>& t)
+  constexpr clause_base(const clause_base<truncate_t<Tab>, OtherStatement>& t)
       : _table(t.table) {}
 
-  clause_base(Tab table) : _table(table) {}
+  constexpr clause_base(Tab table) : _table(table) {}
 
   Tab _table;
 };
@@ -65,9 +67,20 @@ struct clause_result_type<truncate_t<Tab>> {
 };
 
 template <typename Context, typename Tab, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<truncate_t<Tab>, Statement>& t) {
-  return "TRUNCATE " + to_sql_name(context, name_tag_of_t<Tab>{});
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<truncate_t<Tab>, Statement>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += "TRUNCATE ";
+  sql += to_sql_name(context, name_tag_of_t<Tab>{});
+}
+
+template <typename Context, typename Tab, typename Statement>
+auto sql_length_estimate(const Context& context,
+                         const clause_base<truncate_t<Tab>, Statement>&)
+    -> std::size_t {
+  return sql_length("TRUNCATE ") +
+         to_sql_name(context, name_tag_of_t<Tab>{}).size();
 }
 
 template <Table Tab>
@@ -27,8 +27,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/flags.h>
 #include <sqlpp20/result_row.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
@@ -64,11 +66,12 @@ template <typename Flag, typename LeftSelect, typename RightSelect,
 class clause_base<union_t<Flag, LeftSelect, RightSelect>, BaseStatement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<union_t<Flag, LeftSelect, RightSelect>,
-                                OtherStatement>& s)
+  constexpr clause_base(
+      const clause_base<union_t<Flag, LeftSelect, RightSelect>,
+                        OtherStatement>& s)
       : _left(s._left), _right(s._right) {}
 
-  clause_base(const union_t<Flag, LeftSelect, RightSelect>& f)
+  constexpr clause_base(const union_t<Flag, LeftSelect, RightSelect>& f)
       : _flag(f._flag), _left(f._left), _right(f._right) {}
 
   Flag _flag;
@@ -85,12 +88,25 @@ struct result_row_of<
 
 template <typename Context, typename Flag, typename LeftSelect,
           typename RightSelect, typename BaseStatement>
-[[nodiscard]] auto to_sql_string(
-    Context& context,
-    const clause_base<union_t<Flag, LeftSelect, RightSelect>, BaseStatement>& t) {
+constexpr auto serialize(
+    Context& context, std::string& sql,
+    const clause_base<union_t<Flag, LeftSelect, RightSelect>, BaseStatement>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
 #warning missing flag serialization?
-  return to_sql_string(context, t._left) + " UNION " +
-         to_sql_string(context, t._right);
+  serialize(context, sql, t._left);
+  sql += " UNION ";
+  serialize(context, sql, t._right);
+}
+
+template <typename Context, typename Flag, typename LeftSelect,
+          typename RightSelect, typename BaseStatement>
+auto sql_length_estimate(
+    const Context& context,
+    const clause_base<union_t<Flag, LeftSelect, RightSelect>, BaseStatement>& t)
+    -> std::size_t {
+  return sql_length_estimate(context, t._left) + sql_length(" UNION ") +
+         sql_length_estimate(context, t._right);
 }
 
 struct no_union_t {};
@@ -117,9 +133,10 @@ class clause_base<no_union_t, BaseStatement> {
 };
 
 template <typename Context, typename BaseStatement>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const clause_base<no_union_t, BaseStatement>&) {
-  return std::string{};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<no_union_t, BaseStatement>& t)
+    -> void {
+  detail::serialize_custom(context, sql, t);
 }
 
 template <SelectStatement LeftSelect, SelectStatement RightSelect>
@@ -29,6 +29,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlpp20/clause/update_set.h>
 #include <sqlpp20/clause/where.h>
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/type_traits.h>
 
 namespace sqlpp {
@@ -49,18 +51,28 @@ template <typename Table, typename Statement>
 class clause_base<update_t<Table>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<update_t<Table>, OtherStatement>& s)
+  constexpr clause_base(const clause_base<update_t<Table>, OtherStatement>& s)
       : _table(s._table) {}
 
-  clause_base(Table table) : _table(table) {}
+  constexpr clause_base(Table table) : _table(table) {}
 
   Table _table;
 };
 
 template <typename Context, typename Table, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<update_t<Table>, Statement>& t) {
-  return std::string("UPDATE ") + to_sql_string(context, t._table);
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<update_t<Table>, Statement>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += "UPDATE ";
+  serialize(context, sql, t._table);
+}
+
+template <typename Context, typename Table, typename Statement>
+auto sql_length_estimate(const Context& context,
+                         const clause_base<update_t<Table>, Statement>& t)
+    -> std::size_t {
+  return sql_length("UPDATE ") + sql_length_estimate(context, t._table);
 }
 
 template <PrimaryTable Table>
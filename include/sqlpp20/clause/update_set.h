@@ -27,6 +27,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/free_column.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/tuple_to_sql_string.h>
@@ -42,19 +43,40 @@ struct update_assignment_t {
 };
 
 template <typename Context, typename Assignment>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const update_assignment_t<Assignment>& assignment) {
-  auto ret = to_sql_string(
-      context, free_column_t<column_of_t<remove_optional_t<Assignment>>>{});
+constexpr auto serialize(Context& context, std::string& sql,
+                         const update_assignment_t<Assignment>& assignment)
+    -> void {
+  if (detail::serialize_custom(context, sql, assignment)) return;
+  const auto column =
+      free_column_t<column_of_t<remove_optional_t<Assignment>>>{};
+  serialize(context, sql, column);
+  sql += " = ";
   if constexpr (::sqlpp::is_optional_v<Assignment>) {
     if (assignment._assignment)
-      return ret + " = " +
-             to_sql_string(context, assignment._assignment.value().value);
+      serialize(context, sql, assignment._assignment.value().value);
     else {
-      return ret + " = " + ret;
+      serialize(context, sql, column);
     }
   } else {
-    return ret + " = " + to_sql_string(context, assignment._assignment.value);
+    serialize(context, sql, assignment._assignment.value);
+  }
+}
+
+template <typename Context, typename Assignment>
+auto sql_length_estimate(const Context& context,
+                         const update_assignment_t<Assignment>& assignment)
+    -> std::size_t {
+  const auto column =
+      free_column_t<column_of_t<remove_optional_t<Assignment>>>{};
+  auto length = sql_length_estimate(context, column) + sql_length(" = ");
+  if constexpr (::sqlpp::is_optional_v<Assignment>) {
+    if (assignment._assignment) {
+      return length +
+             sql_length_estimate(context, assignment._assignment.value().value);
+    }
+    return length + sql_length_estimate(context, column);
+  } else {
+    return length + sql_length_estimate(context, assignment._assignment.value);
   }
 }
 }  // namespace sqlpp
@@ -78,11 +100,11 @@ template <typename... Assignments, typename Statement>
 class clause_base<update_set_t<Assignments...>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(
+  constexpr clause_base(
       const clause_base<update_set_t<Assignments...>, OtherStatement>& s)
       : _assignments(s._assignments) {}
 
-  clause_base(const update_set_t<Assignments...>& f)
+  constexpr clause_base(const update_set_t<Assignments...>& f)
       : _assignments(f._assignments) {}
 
   std::tuple<Assignments...> _assignments;
@@ -97,13 +119,26 @@ struct clause_result_type<update_set_t<Assignments...>> {
 };
 
 template <typename Context, typename... Assignments, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context,
-    const clause_base<update_set_t<Assignments...>, Statement>& t) {
-  return std::string{" SET "} +
-         tuple_to_sql_string(context, ", ",
-                             std::tuple(update_assignment_t<Assignments>{
-                                 std::get<Assignments>(t._assignments)}...));
+constexpr auto serialize(
+    Context& context, std::string& sql,
+    const clause_base<update_set_t<Assignments...>, Statement>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += " SET ";
+  serialize_tuple(context, sql, ", ",
+                  std::tuple(update_assignment_t<Assignments>{
+                      std::get<Assignments>(t._assignments)}...));
+}
+
+template <typename Context, typename Statement, typename... Assignments>
+auto sql_length_estimate(
+    const Context& context,
+    const clause_base<update_set_t<Assignments...>, Statement>& t)
+    -> std::size_t {
+  return sql_length(" SET ") +
+         sql_length_estimate_tuple(
+             context, ", ",
+             std::tuple(update_assignment_t<Assignments>{
+                 std::get<Assignments>(t._assignments)}...));
 }
 
 struct no_update_set_t {};
@@ -126,9 +161,10 @@ class clause_base<no_update_set_t, Statement> {
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<no_update_set_t, Statement>&) {
-  return std::string{};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<no_update_set_t, Statement>& t)
+    -> void {
+  detail::serialize_custom(context, sql, t);
 }
 
 template <typename... Assignments>
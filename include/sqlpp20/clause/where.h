@@ -27,6 +27,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
@@ -49,18 +51,30 @@ template <typename Condition, typename Statement>
 class clause_base<where_t<Condition>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<where_t<Condition>, OtherStatement>& s)
+  constexpr clause_base(
+      const clause_base<where_t<Condition>, OtherStatement>& s)
       : _condition(s._condition) {}
 
-  clause_base(const where_t<Condition>& f) : _condition(f._condition) {}
+  constexpr clause_base(const where_t<Condition>& f)
+      : _condition(f._condition) {}
 
   Condition _condition;
 };
 
 template <typename Context, typename Condition, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<where_t<Condition>, Statement>& t) {
-  return std::string(" WHERE ") + to_sql_string(context, t._condition);
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<where_t<Condition>, Statement>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += " WHERE ";
+  serialize(context, sql, t._condition);
+}
+
+template <typename Context, typename Condition, typename Statement>
+auto sql_length_estimate(const Context& context,
+                         const clause_base<where_t<Condition>, Statement>& t)
+    -> std::size_t {
+  return sql_length(" WHERE ") + sql_length_estimate(context, t._condition);
 }
 
 struct unconditionally_t {};
@@ -79,9 +93,10 @@ class clause_base<unconditionally_t, Statement> {
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const clause_base<unconditionally_t, Statement>& t) {
-  return std::string{};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<unconditionally_t, Statement>& t)
+    -> void {
+  detail::serialize_custom(context, sql, t);
 }
 
 struct no_where_t {};
@@ -107,9 +122,9 @@ class clause_base<no_where_t, Statement> {
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const clause_base<no_where_t, Statement>&) {
-  return std::string{};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<no_where_t, Statement>& t) -> void {
+  detail::serialize_custom(context, sql, t);
 }
 
 template <typename Condition>
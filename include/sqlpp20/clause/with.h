@@ -28,6 +28,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <sqlpp20/clause_fwd.h>
 #include <sqlpp20/cte.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/statement.h>
 #include <sqlpp20/tuple_to_sql_string.h>
 #include <sqlpp20/type_traits.h>
@@ -55,7 +57,7 @@ template <with_mode Mode, typename... CommonTableExpressions>
 template <with_mode Mode, typename... CommonTableExpressions>
 [[nodiscard]] constexpr auto provided_ctes_of([
     [maybe_unused]] type_t<with_t<Mode, CommonTableExpressions...>>) {
-  return (type_set() | ... | provided_ctes_of_v<CommonTableExpressions>);
+  return type_set_union(provided_ctes_of_v<CommonTableExpressions>...);
 };
 
 template <with_mode Mode, typename... CommonTableExpressions>
@@ -67,38 +69,66 @@ template <with_mode Mode, typename... CommonTableExpressions,
 class clause_base<with_t<Mode, CommonTableExpressions...>, Statement> {
  public:
   template <typename OtherStatement>
-  clause_base(const clause_base<with_t<Mode, CommonTableExpressions...>,
-                                OtherStatement>& s)
+  constexpr clause_base(
+      const clause_base<with_t<Mode, CommonTableExpressions...>,
+                        OtherStatement>& s)
       : _ctes(s._ctes) {}
 
-  clause_base(const with_t<Mode, CommonTableExpressions...>& f)
+  constexpr clause_base(const with_t<Mode, CommonTableExpressions...>& f)
       : _ctes(f._ctes) {}
 
   std::tuple<CommonTableExpressions...> _ctes;
 };
 
 template <typename Context>
-[[nodiscard]] auto to_sql_string(Context& context, with_mode mode) {
+constexpr auto serialize(Context& context, std::string& sql,
+                         with_mode mode) -> void {
+  if (detail::serialize_custom(context, sql, mode)) return;
   switch (mode) {
     case with_mode::flat:
-      return std::string("");
+      return;
     case with_mode::recursive:
-      return std::string("RECURSIVE ");
+      sql += "RECURSIVE ";
+      return;
   }
 }
 
+template <typename Context>
+auto sql_length_estimate(const Context&, with_mode mode) -> std::size_t {
+  return mode == with_mode::recursive ? sql_length("RECURSIVE ") : 0;
+}
+
 template <typename Context, with_mode Mode, typename... CommonTableExpressions,
           typename Statement>
-[[nodiscard]] auto to_sql_string(
-    Context& context,
-    const clause_base<with_t<Mode, CommonTableExpressions...>, Statement>& t) {
+constexpr auto serialize(
+    Context& context, std::string& sql,
+    const clause_base<with_t<Mode, CommonTableExpressions...>, Statement>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
   int index = -1;
-  return std::string{"WITH "} + to_sql_string(context, Mode) +
-         (std::string() + ... +
-          ((++index ? ", " : "") +
-           to_full_sql_string(context,
-                              std::get<CommonTableExpressions>(t._ctes)))) +
-         " ";
+  sql += "WITH ";
+  serialize(context, sql, Mode);
+  ((sql += (++index ? ", " : ""),
+    serialize_full(context, sql, std::get<CommonTableExpressions>(t._ctes))),
+   ...);
+  sql += " ";
+}
+
+template <typename Context, with_mode Mode, typename... CommonTableExpressions,
+          typename Statement>
+auto sql_length_estimate(
+    const Context& context,
+    const clause_base<with_t<Mode, CommonTableExpressions...>, Statement>& t)
+    -> std::size_t {
+  constexpr auto separators =
+      sizeof...(CommonTableExpressions) ? sizeof...(CommonTableExpressions) - 1
+                                        : 0;
+  return sql_length("WITH ") + sql_length_estimate(context, Mode) +
+         sql_length(", ") * separators +
+         (std::size_t{0} + ... +
+          sql_length_estimate_full(
+              context, std::get<CommonTableExpressions>(t._ctes))) +
+         1;
 }
 
 struct no_with_t {};
@@ -127,9 +157,9 @@ class clause_base<no_with_t, Statement> {
 };
 
 template <typename Context, typename Statement>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const clause_base<no_with_t, Statement>&) {
-  return std::string{};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const clause_base<no_with_t, Statement>& t) -> void {
+  detail::serialize_custom(context, sql, t);
 }
 
 template <typename... CommonTableExpressions>
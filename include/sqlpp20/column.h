@@ -27,7 +27,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/alias.h>
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/operator.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_name.h>
 #include <sqlpp20/type_traits.h>
 
@@ -39,7 +41,7 @@ class column_t {
 
  public:
   template <typename T>
-  [[nodiscard]] auto operator=(T t) const {
+  [[nodiscard]] constexpr auto operator=(T t) const {
     return assign(*this, t);
   }
 
@@ -125,10 +127,20 @@ template <typename... ProvidedTables, typename TableSpec, typename ColumnSpec>
 }
 
 template <typename Context, typename TableSpec, typename ColumnSpec>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const column_t<TableSpec, ColumnSpec>& t) {
-  return to_sql_name(context, TableSpec{}) + "." +
-         to_sql_name(context, ColumnSpec{});
+constexpr auto serialize(Context& context, std::string& sql,
+                         const column_t<TableSpec, ColumnSpec>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += to_sql_name(context, TableSpec{});
+  sql += ".";
+  sql += to_sql_name(context, ColumnSpec{});
+}
+
+template <typename Context, typename TableSpec, typename ColumnSpec>
+auto sql_length_estimate(const Context& context,
+                         const column_t<TableSpec, ColumnSpec>&)
+    -> std::size_t {
+  return to_sql_name(context, TableSpec{}).size() + 1 +
+         to_sql_name(context, ColumnSpec{}).size();
 }
 
 }  // namespace sqlpp
@@ -28,6 +28,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <functional>
 #include <string_view>
+#include <utility>
 
 namespace sqlpp {
 struct connection {};
@@ -43,6 +44,17 @@ struct pool_base {
   pool_base() = default;
 
   pool_base(Pool* connection_pool) : _connection_pool{connection_pool} {}
+
+  // Moved-from connections must not hand anything back to the pool
+  pool_base(const pool_base&) = delete;
+  pool_base(pool_base&& rhs) noexcept
+      : _connection_pool{std::exchange(rhs._connection_pool, nullptr)} {}
+  pool_base& operator=(const pool_base&) = delete;
+  pool_base& operator=(pool_base&& rhs) noexcept {
+    _connection_pool = std::exchange(rhs._connection_pool, nullptr);
+    return *this;
+  }
+  ~pool_base() = default;
 };
 
 template <>
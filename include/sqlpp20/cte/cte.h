@@ -28,7 +28,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <sqlpp20/clause/union.h>
 #include <sqlpp20/column.h>
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/result_row.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/table_spec.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
@@ -61,7 +63,7 @@ template <typename CteType, typename TableSpec, typename Stat>
 struct cte_t : cte_columns_t<TableSpec, result_row_of_t<Stat>> {
   Stat _statement;
 
-  cte_t(Stat statement) : _statement(statement) {}
+  constexpr cte_t(Stat statement) : _statement(statement) {}
 
   template <SelectStatement SecondStat>
   requires(not is_cte_recursive_v<cte_t> and are_union_compatible_v<cte_t, SecondStat>)
@@ -130,16 +132,37 @@ struct name_tag_of<cte_t<CteType, TableSpec, Stat>> {
 
 template <typename Context, typename CteType, typename TableSpec,
           typename Stat>
-[[nodiscard]] auto to_full_sql_string(
-    Context& context, const cte_t<CteType, TableSpec, Stat>& t) {
-  return to_sql_name(context, t) + " AS (" +
-         to_sql_string(context, t._statement) + ")";
+constexpr auto serialize_full(Context& context, std::string& sql,
+                              const cte_t<CteType, TableSpec, Stat>& t)
+    -> void {
+  sql += to_sql_name(context, t);
+  sql += " AS (";
+  serialize(context, sql, t._statement);
+  sql += ")";
 }
 
 template <typename Context, typename CteType, typename TableSpec,
           typename Stat>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const cte_t<CteType, TableSpec, Stat>& t) {
-  return to_sql_name(context, t);
+auto sql_length_estimate_full(const Context& context,
+                              const cte_t<CteType, TableSpec, Stat>& t)
+    -> std::size_t {
+  return to_sql_name(context, t).size() + sql_length(" AS (") +
+         sql_length_estimate(context, t._statement) + 1;
+}
+
+template <typename Context, typename CteType, typename TableSpec,
+          typename Stat>
+constexpr auto serialize(Context& context, std::string& sql,
+                         const cte_t<CteType, TableSpec, Stat>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += to_sql_name(context, t);
+}
+
+template <typename Context, typename CteType, typename TableSpec,
+          typename Stat>
+auto sql_length_estimate(const Context& context,
+                         const cte_t<CteType, TableSpec, Stat>& t)
+    -> std::size_t {
+  return to_sql_name(context, t).size();
 }
 }  // namespace sqlpp
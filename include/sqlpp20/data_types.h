@@ -61,4 +61,14 @@ struct cpp_type<text> {
   using type = std::string_view;
 };
 
+struct blob {};
+
+template <>
+constexpr auto is_blob_v<blob> = true;
+
+template <>
+struct cpp_type<blob> {
+  using type = std::span<const std::uint8_t>;
+};
+
 }  // namespace sqlpp
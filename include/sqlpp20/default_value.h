@@ -26,6 +26,8 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_string.h>
 
 #include <iostream>
@@ -36,9 +38,16 @@ struct default_value_t {};
 inline constexpr auto default_value = ::sqlpp::default_value_t{};
 
 template <typename Context>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const ::sqlpp::default_value_t&) {
-  return std::string{"DEFAULT"};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const ::sqlpp::default_value_t& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += "DEFAULT";
+}
+
+template <typename Context>
+auto sql_length_estimate(const Context&, const ::sqlpp::default_value_t&)
+    -> std::size_t {
+  return sql_length("DEFAULT");
 }
 
 }  // namespace sqlpp
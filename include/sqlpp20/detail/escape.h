@@ -0,0 +1,112 @@
+#pragma once
+
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <bit>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace sqlpp::detail {
+template <char... Specials>
+constexpr auto is_special(char c) -> bool {
+  return ((c == Specials) or ...);
+}
+
+// Returns the first character in [begin, end) that is one of the Specials (or
+// end). Where available, 32 (AVX2) or 16 (SSE2) bytes are compared at once.
+template <char... Specials>
+auto find_special(const char* begin, const char* const end) -> const char* {
+#if defined(__AVX2__)
+  for (; end - begin >= 32; begin += 32) {
+    const auto chunk =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+    auto matches = _mm256_setzero_si256();
+    ((matches = _mm256_or_si256(
+          matches, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(Specials)))),
+     ...);
+    if (const auto mask =
+            static_cast<unsigned>(_mm256_movemask_epi8(matches))) {
+      return begin + std::countr_zero(mask);
+    }
+  }
+#endif
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+  for (; end - begin >= 16; begin += 16) {
+    const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+    auto matches = _mm_setzero_si128();
+    ((matches = _mm_or_si128(matches,
+                             _mm_cmpeq_epi8(chunk, _mm_set1_epi8(Specials)))),
+     ...);
+    if (const auto mask = static_cast<unsigned>(_mm_movemask_epi8(matches))) {
+      return begin + std::countr_zero(mask);
+    }
+  }
+#endif
+  return std::find_if(begin, end, is_special<Specials...>);
+}
+
+// Appends `text` as a quoted string literal, doubling each of the Specials.
+template <char... Specials>
+constexpr auto serialize_escaped(std::string& sql, const std::string_view& text)
+    -> void {
+  if (std::is_constant_evaluated()) {
+    sql.push_back('\'');
+    for (const auto c : text) {
+      if (is_special<Specials...>(c)) sql.push_back(c);
+      sql.push_back(c);
+    }
+    sql.push_back('\'');
+    return;
+  }
+
+  // Most strings contain few characters that need escaping. Size the buffer
+  // for the plain text (keeping growth geometric) and copy unescaped runs
+  // in bulk.
+  if (const auto required = sql.size() + text.size() + 2;
+      required > sql.capacity()) {
+    sql.reserve(std::max(required, 2 * sql.capacity()));
+  }
+  sql.push_back('\'');
+  const auto* const end = text.data() + text.size();
+  for (auto begin = text.data();;) {
+    const auto special = find_special<Specials...>(begin, end);
+    sql.append(begin, special);
+    if (special == end) break;
+    sql.append(2, *special);
+    begin = special + 1;
+  }
+  sql.push_back('\'');
+}
+}  // namespace sqlpp::detail
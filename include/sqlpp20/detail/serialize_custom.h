@@ -0,0 +1,69 @@
+#pragma once
+
+/*
+Copyright (c) 2017 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <concepts>
+#include <string>
+#include <string_view>
+
+namespace sqlpp::detail::customization {
+struct not_customized_t {};
+
+// Has the same signature as the generic to_sql_string() in namespace sqlpp.
+// Where both are candidates, the call is ambiguous, so that only overloads
+// which are more specialized than either (e.g. for a specific context type)
+// are detected as customizations.
+template <typename Context, typename T>
+auto to_sql_string(Context& context, const T& t) -> not_customized_t;
+
+template <typename Context, typename T>
+concept has_custom_to_sql_string = requires(Context& context, const T& t) {
+  { to_sql_string(context, t) } -> std::convertible_to<std::string_view>;
+};
+
+template <typename Context, typename T>
+auto append_custom_to_sql_string(Context& context, std::string& sql,
+                                 const T& t) -> void {
+  sql += to_sql_string(context, t);
+}
+}  // namespace sqlpp::detail::customization
+
+namespace sqlpp::detail {
+// Objects used to be customized by overloading to_sql_string(context, t),
+// which returns the SQL text of the object. If such an overload exists, its
+// result is appended instead of the library's serialization.
+template <typename Context, typename T>
+constexpr auto serialize_custom(Context& context, std::string& sql,
+                                const T& t) -> bool {
+  if constexpr (customization::has_custom_to_sql_string<Context, T>) {
+    customization::append_custom_to_sql_string(context, sql, t);
+    return true;
+  } else {
+    return false;
+  }
+}
+}  // namespace sqlpp::detail
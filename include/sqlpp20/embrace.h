@@ -26,6 +26,8 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/type_traits.h>
 
 #include <string>
@@ -38,8 +40,18 @@ struct embrace_t {
 };
 
 template <typename Context, typename Expr>
-[[nodiscard]] auto to_sql_string(Context& context, const embrace_t<Expr>& t) {
-  return std::string{"("} + to_sql_string(context, t._expr) + ")";
+constexpr auto serialize(Context& context, std::string& sql,
+                         const embrace_t<Expr>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += "(";
+  serialize(context, sql, t._expr);
+  sql += ")";
+}
+
+template <typename Context, typename Expr>
+auto sql_length_estimate(const Context& context, const embrace_t<Expr>& t)
+    -> std::size_t {
+  return 2 + sql_length_estimate(context, t._expr);
 }
 
 template <typename Expr>
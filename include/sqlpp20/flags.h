@@ -26,12 +26,16 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
+
 namespace sqlpp {
 struct no_flag_t {};
 
 template <typename Context>
-[[nodiscard]] auto to_sql_string(Context& context, const no_flag_t& t) {
-  return std::string{""};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const no_flag_t& t) -> void {
+  detail::serialize_custom(context, sql, t);
 }
 
 struct all_t {};
@@ -39,8 +43,15 @@ struct all_t {};
 inline constexpr auto all = all_t{};
 
 template <typename Context>
-[[nodiscard]] auto to_sql_string(Context& context, const all_t& t) {
-  return std::string{"ALL "};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const all_t& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += "ALL ";
+}
+
+template <typename Context>
+auto sql_length_estimate(const Context&, const all_t&) -> std::size_t {
+  return sql_length("ALL ");
 }
 
 struct distinct_t {};
@@ -48,7 +59,14 @@ struct distinct_t {};
 inline constexpr auto distinct = distinct_t{};
 
 template <typename Context>
-[[nodiscard]] auto to_sql_string(Context& context, const distinct_t& t) {
-  return std::string{"DISTINCT "};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const distinct_t& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += "DISTINCT ";
+}
+
+template <typename Context>
+auto sql_length_estimate(const Context&, const distinct_t&) -> std::size_t {
+  return sql_length("DISTINCT ");
 }
 }  // namespace sqlpp
@@ -26,6 +26,8 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_name.h>
 #include <sqlpp20/type_traits.h>
 
@@ -38,9 +40,16 @@ template <typename ColumnSpec>
 struct free_column_t {};
 
 template <typename Context, typename ColumnSpec>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const free_column_t<ColumnSpec>& t) {
-  return to_sql_name(context, ColumnSpec{});
+constexpr auto serialize(Context& context, std::string& sql,
+                         const free_column_t<ColumnSpec>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += to_sql_name(context, ColumnSpec{});
+}
+
+template <typename Context, typename ColumnSpec>
+auto sql_length_estimate(const Context& context,
+                         const free_column_t<ColumnSpec>&) -> std::size_t {
+  return to_sql_name(context, ColumnSpec{}).size();
 }
 
 }  // namespace sqlpp
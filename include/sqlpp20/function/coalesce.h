@@ -26,6 +26,8 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_string.h>
 #include <sqlpp20/tuple_to_sql_string.h>
 #include <sqlpp20/type_traits.h>
@@ -68,9 +70,19 @@ struct value_type_of<coalesce_t<Arg0, Args...>> {
 };
 
 template <typename Context, typename... Args>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const coalesce_t<Args...>& t) {
-  return "COALESCE(" + tuple_to_sql_string(context, ", ", t.args) + ")";
+constexpr auto serialize(Context& context, std::string& sql,
+                         const coalesce_t<Args...>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += "COALESCE(";
+  serialize_tuple(context, sql, ", ", t.args);
+  sql += ")";
+}
+
+template <typename Context, typename... Args>
+auto sql_length_estimate(const Context& context, const coalesce_t<Args...>& t)
+    -> std::size_t {
+  return sql_length("COALESCE(") +
+         sql_length_estimate_tuple(context, ", ", t.args) + 1;
 }
 
 }  // namespace sqlpp
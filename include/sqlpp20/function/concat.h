@@ -27,6 +27,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/bad_expression.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_string.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
@@ -57,8 +59,16 @@ template <typename... Args>
 struct requires_braces<concat_t<Args...>> : std::true_type {};
 
 template <typename Context, typename... Args>
-[[nodiscard]] auto to_sql_string(Context& context, const concat_t<Args...>& t) {
-  return tuple_to_sql_string(context, " || ", t.args);
+constexpr auto serialize(Context& context, std::string& sql,
+                         const concat_t<Args...>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  serialize_tuple(context, sql, " || ", t.args);
+}
+
+template <typename Context, typename... Args>
+auto sql_length_estimate(const Context& context, const concat_t<Args...>& t)
+    -> std::size_t {
+  return sql_length_estimate_tuple(context, " || ", t.args);
 }
 
 }  // namespace sqlpp
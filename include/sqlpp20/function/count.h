@@ -28,7 +28,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <sqlpp20/aggregate.h>
 #include <sqlpp20/bad_expression.h>
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/flags.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
 
@@ -37,8 +39,15 @@ struct asterisk_t {};
 inline constexpr auto asterisk = asterisk_t{};
 
 template <typename Context>
-[[nodiscard]] auto to_sql_string(Context& context, const asterisk_t& t) {
-  return std::string{"*"};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const asterisk_t& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += "*";
+}
+
+template <typename Context>
+auto sql_length_estimate(const Context&, const asterisk_t&) -> std::size_t {
+  return 1;
 }
 
 template <typename Flag>
@@ -26,7 +26,9 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/join/join_functions.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/type_traits.h>
 
 namespace sqlpp {
@@ -48,18 +50,32 @@ struct nodes_of<join_t<Lhs, JoinType, Rhs, Condition>> {
 
 template <typename Context, typename Lhs, typename JoinType, typename Rhs,
           typename Condition>
-[[nodiscard]] auto to_sql_string(
-    Context& context, const join_t<Lhs, JoinType, Rhs, Condition>& t) {
-  auto ret = to_sql_string(context, t._lhs);
+constexpr auto serialize(Context& context, std::string& sql,
+                         const join_t<Lhs, JoinType, Rhs, Condition>& t)
+    -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  serialize(context, sql, t._lhs);
 
   if (has_value(t._rhs)) {
-    ret += JoinType::_name;
-    ret += " JOIN ";
-    ret += to_sql_string(context, get_value(t._rhs));
-    ret += to_sql_string(context, t._condition);
+    sql += JoinType::_name;
+    sql += " JOIN ";
+    serialize(context, sql, get_value(t._rhs));
+    serialize(context, sql, t._condition);
   }
+}
 
-  return ret;
+template <typename Context, typename Lhs, typename JoinType, typename Rhs,
+          typename Condition>
+auto sql_length_estimate(const Context& context,
+                         const join_t<Lhs, JoinType, Rhs, Condition>& t)
+    -> std::size_t {
+  auto length = sql_length_estimate(context, t._lhs);
+  if (has_value(t._rhs)) {
+    length += std::string_view{JoinType::_name}.size() + sql_length(" JOIN ") +
+              sql_length_estimate(context, get_value(t._rhs)) +
+              sql_length_estimate(context, t._condition);
+  }
+  return length;
 }
 
 template <typename Lhs, typename JoinType, typename Rhs, typename Condition>
@@ -26,6 +26,8 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/unconditional.h>
 
@@ -41,13 +43,28 @@ struct nodes_of<on_t<Expression>> {
 };
 
 template <typename Context, typename Expression>
-[[nodiscard]] auto to_sql_string(Context& context, const on_t<Expression>& t) {
-  return std::string{" ON "} + to_sql_string(context, t._expression);
+constexpr auto serialize(Context& context, std::string& sql,
+                         const on_t<Expression>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += " ON ";
+  serialize(context, sql, t._expression);
+}
+
+template <typename Context, typename Expression>
+auto sql_length_estimate(const Context& context, const on_t<Expression>& t)
+    -> std::size_t {
+  return sql_length(" ON ") + sql_length_estimate(context, t._expression);
+}
+
+template <typename Context>
+constexpr auto serialize(Context& context, std::string& sql,
+                         const on_t<unconditional_t>& t) -> void {
+  detail::serialize_custom(context, sql, t);
 }
 
 template <typename Context>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const on_t<unconditional_t>& t) {
-  return std::string{};
+auto sql_length_estimate(const Context&, const on_t<unconditional_t>&)
+    -> std::size_t {
+  return 0;
 }
 }  // namespace sqlpp
@@ -0,0 +1,77 @@
+#pragma once
+
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <concepts>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace sqlpp {
+// A literal value that has been replaced by a placeholder in the SQL text.
+using literal_parameter_t =
+    std::variant<bool, std::int64_t, double, std::string>;
+
+// Lifted literal values in the order of their placeholders.
+using literal_parameters_t = std::vector<literal_parameter_t>;
+
+// Contexts opt into literal parameterization by providing a
+// `literal_parameters_t* literal_parameters` member and serialize_placeholder().
+// While the member is set, literal values are collected there instead of being
+// written into the SQL text. This keeps the text of a statement stable across
+// values, so that the server (or a statement cache) can reuse its plan.
+template <typename Context>
+concept literal_parameterizing_context = requires(Context& context) {
+  { context.literal_parameters } -> std::same_as<literal_parameters_t*&>;
+};
+
+namespace detail {
+// Returns true if `value` has been lifted into a parameter. Strings are
+// copied only if they are lifted.
+template <typename Context, typename T>
+constexpr auto serialize_lifted_literal(Context& context, std::string& sql,
+                                        T&& value) -> bool {
+  if constexpr (literal_parameterizing_context<Context>) {
+    if (context.literal_parameters) {
+      if constexpr (std::is_same_v<std::remove_cvref_t<T>, std::string_view>) {
+        context.literal_parameters->emplace_back(
+            std::in_place_type<std::string>, value);
+      } else {
+        context.literal_parameters->emplace_back(std::forward<T>(value));
+      }
+      serialize_placeholder(context, sql);
+      return true;
+    }
+  }
+  return false;
+}
+}  // namespace detail
+}  // namespace sqlpp
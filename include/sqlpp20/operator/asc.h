@@ -26,6 +26,8 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_string.h>
 
 #include <type_traits>
@@ -59,20 +61,34 @@ template <typename L>
 constexpr auto is_sort_order_v<sort_order_t<L>> = true;
 
 template <typename Context>
-[[nodiscard]] auto to_sql_string(Context& context, const sort_order& t) {
+constexpr auto serialize(Context& context, std::string& sql,
+                         const sort_order& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
   switch (t) {
     case sort_order::asc:
-      return std::string(" ASC");
+      sql += " ASC";
+      return;
     case sort_order::desc:
       [[fallthrough]];
     default:
-      return std::string(" DESC");
+      sql += " DESC";
+      return;
   }
 }
 
 template <typename Context, typename L>
-[[nodiscard]] auto to_sql_string(Context& context, const sort_order_t<L>& t) {
-  return to_sql_string(context, embrace(t.l)) + to_sql_string(context, t.order);
+constexpr auto serialize(Context& context, std::string& sql,
+                         const sort_order_t<L>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  serialize(context, sql, embrace(t.l));
+  serialize(context, sql, t.order);
+}
+
+template <typename Context, typename L>
+auto sql_length_estimate(const Context& context, const sort_order_t<L>& t)
+    -> std::size_t {
+  return sql_length_estimate(context, embrace(t.l)) +
+         (t.order == sort_order::asc ? sql_length(" ASC") : sql_length(" DESC"));
 }
 
 }  // namespace sqlpp
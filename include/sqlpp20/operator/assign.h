@@ -26,6 +26,8 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_string.h>
 #include <sqlpp20/type_traits.h>
 
@@ -63,6 +65,13 @@ requires((can_be_null_v<L> or not can_be_null_v<R>)and has_boolean_value_v<L>and
   return assign_t<L, R>{column, value};
 }
 
+template <typename L, typename R>
+requires((can_be_null_v<L> or not can_be_null_v<R>)and has_blob_value_v<L>and
+             has_blob_value_v<R>) constexpr auto assign(L column, R value)
+    -> assign_t<L, R> {
+  return assign_t<L, R>{column, value};
+}
+
 template <typename L, typename R>
 constexpr auto is_assignment_v<assign_t<L, R>> = true;
 
@@ -75,8 +84,18 @@ template <typename L, typename R>
 constexpr auto requires_braces_v<assign_t<L, R>> = true;
 
 template <typename Context, typename L, typename R>
-[[nodiscard]] auto to_sql_string(Context& context, const assign_t<L, R>& t) {
-  return to_sql_string(context, t.column) + " = " +
-         to_sql_string(context, embrace(t.value));
+constexpr auto serialize(Context& context, std::string& sql,
+                         const assign_t<L, R>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  serialize(context, sql, t.column);
+  sql += " = ";
+  serialize(context, sql, embrace(t.value));
+}
+
+template <typename Context, typename L, typename R>
+auto sql_length_estimate(const Context& context, const assign_t<L, R>& t)
+    -> std::size_t {
+  return sql_length_estimate(context, t.column) + sql_length(" = ") +
+         sql_length_estimate(context, embrace(t.value));
 }
 }  // namespace sqlpp
@@ -26,6 +26,8 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_string.h>
 #include <sqlpp20/type_traits.h>
 
@@ -53,8 +55,18 @@ struct value_type_of<exists_t<SubQuery>> {
 };
 
 template <typename Context, typename SubQuery>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const exists_t<SubQuery>& t) {
-  return " EXISTS(" + to_sql_string(context, t.sub_query) + ") ";
+constexpr auto serialize(Context& context, std::string& sql,
+                         const exists_t<SubQuery>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += " EXISTS(";
+  serialize(context, sql, t.sub_query);
+  sql += ") ";
+}
+
+template <typename Context, typename SubQuery>
+auto sql_length_estimate(const Context& context, const exists_t<SubQuery>& t)
+    -> std::size_t {
+  return sql_length(" EXISTS(") + sql_length_estimate(context, t.sub_query) +
+         sql_length(") ");
 }
 }  // namespace sqlpp
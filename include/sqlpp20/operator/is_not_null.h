@@ -26,6 +26,8 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_string.h>
 #include <sqlpp20/type_traits.h>
 
@@ -55,7 +57,17 @@ template <typename L>
 constexpr auto requires_braces_v<is_not_null_t<L>> = true;
 
 template <typename Context, typename L>
-[[nodiscard]] auto to_sql_string(Context& context, const is_not_null_t<L>& t) {
-  return to_sql_string(embrace(t.l)) + " IS NOT NULL";
+constexpr auto serialize(Context& context, std::string& sql,
+                         const is_not_null_t<L>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  serialize(context, sql, embrace(t.l));
+  sql += " IS NOT NULL";
+}
+
+template <typename Context, typename L>
+auto sql_length_estimate(const Context& context, const is_not_null_t<L>& t)
+    -> std::size_t {
+  return sql_length_estimate(context, embrace(t.l)) +
+         sql_length(" IS NOT NULL");
 }
 }  // namespace sqlpp
@@ -26,6 +26,8 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_string.h>
 #include <sqlpp20/type_traits.h>
 
@@ -71,14 +73,23 @@ template <typename L, typename... Args>
 constexpr auto requires_braces_v<not_in_t<L, Args...>> = true;
 
 template <typename Context, typename L, typename... Args>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const not_in_t<L, Args...>& t) {
+constexpr auto serialize(Context& context, std::string& sql,
+                         const not_in_t<L, Args...>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  serialize(context, sql, embrace(t.l));
+  sql += " IN(";
   if constexpr (sizeof...(Args) == 1) {
-    return to_sql_string(context, embrace(t.l)) + " IN(" +
-           to_sql_string(context, std::get<0>(t.args)) + ")";
+    serialize(context, sql, std::get<0>(t.args));
   } else {
-    return to_sql_string(context, embrace(t.l)) + " IN(" +
-           tuple_to_sql_string(context, ", ", t.args) + ")";
+    serialize_tuple(context, sql, ", ", t.args);
   }
+  sql += ")";
+}
+
+template <typename Context, typename L, typename... Args>
+auto sql_length_estimate(const Context& context, const not_in_t<L, Args...>& t)
+    -> std::size_t {
+  return sql_length_estimate(context, embrace(t.l)) + sql_length(" IN(") +
+         sql_length_estimate_tuple(context, ", ", t.args) + sql_length(")");
 }
 }  // namespace sqlpp
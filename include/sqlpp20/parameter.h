@@ -27,6 +27,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/bad_expression.h>
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
 
@@ -61,9 +63,16 @@ template <typename ValueType>
 static constexpr auto parameter = unnamed_parameter_t<ValueType>{};
 
 template <typename Context, typename ValueType, typename NameTag>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const parameter_t<ValueType, NameTag>& t) {
-  return std::string{"?"};
+constexpr auto serialize(Context& context, std::string& sql,
+                         const parameter_t<ValueType, NameTag>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += "?";
+}
+
+template <typename Context, typename ValueType, typename NameTag>
+auto sql_length_estimate(const Context&, const parameter_t<ValueType, NameTag>&)
+    -> std::size_t {
+  return 1;
 }
 
 }  // namespace sqlpp
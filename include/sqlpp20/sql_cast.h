@@ -26,6 +26,8 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/to_sql_string.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/value_type_to_sql_string.h>
@@ -62,10 +64,27 @@ template <typename ValueType, typename Expression>
 }
 
 template <typename Context, typename ValueType, typename Expression>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const sql_cast_t<ValueType, Expression>& t) {
-  return " CAST(" + to_sql_string(context, t._expression) + " AS " +
-         value_type_to_sql_string(context, type_t<ValueType>{}) + ")";
+constexpr auto serialize(Context& context, std::string& sql,
+                         const sql_cast_t<ValueType, Expression>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += " CAST(";
+  serialize(context, sql, t._expression);
+  sql += " AS ";
+  sql += value_type_to_sql_string(context, type_t<ValueType>{});
+  sql += ")";
+}
+
+template <typename Context, typename ValueType, typename Expression>
+auto sql_length_estimate(const Context& context,
+                         const sql_cast_t<ValueType, Expression>& t)
+    -> std::size_t {
+  // value_type_to_sql_string() is not available for const contexts
+  auto copy = context;
+  return sql_length(" CAST(") + sql_length_estimate(context, t._expression) +
+         sql_length(" AS ") +
+         std::string_view{value_type_to_sql_string(copy, type_t<ValueType>{})}
+             .size() +
+         1;
 }
 
 }  // namespace sqlpp
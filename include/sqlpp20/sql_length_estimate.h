@@ -0,0 +1,52 @@
+#pragma once
+
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstddef>
+
+namespace sqlpp {
+// sql_length_estimate() returns the expected length of the text that
+// serialize() appends for an object. Serializing a statement reserves that
+// much space up front, so that the buffer does not have to grow while the
+// statement is written.
+//
+// Expressions, clauses and literals provide overloads next to their
+// serialize(). These are exact for fixed-width parts and names, assume no
+// escaping for text, and add up the estimates of their children. Objects
+// without an overload (e.g. empty clauses, which serialize nothing, or node
+// types defined outside the library) do not add to the estimate.
+template <typename Context, typename T>
+auto sql_length_estimate(const Context&, const T&) -> std::size_t {
+  return 0;
+}
+
+// Length of a string literal, without the terminating null character.
+template <std::size_t Size>
+constexpr auto sql_length(const char (&)[Size]) -> std::size_t {
+  return Size - 1;
+}
+}  // namespace sqlpp
@@ -0,0 +1,80 @@
+#pragma once
+
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/to_sql_string.h>
+
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace sqlpp {
+namespace detail {
+// Empty types serialize to the same text every time. Other class templates
+// hold their arguments (e.g. the operands of a comparison), so they carry
+// runtime text if any of their arguments does. Everything else (numbers,
+// strings, optionals, vectors, ...) is runtime data. Templates with members
+// that are not among their arguments specialize this trait.
+template <typename T>
+struct has_runtime_sql_text : std::negation<std::is_empty<T>> {};
+
+template <template <typename...> typename Template, typename... Args>
+struct has_runtime_sql_text<Template<Args...>>
+    : std::conjunction<std::negation<std::is_empty<Template<Args...>>>,
+                       std::disjunction<has_runtime_sql_text<Args>...>> {};
+
+template <typename T>
+struct has_runtime_sql_text<std::optional<T>> : std::true_type {};
+
+template <typename T, typename Allocator>
+struct has_runtime_sql_text<std::vector<T, Allocator>> : std::true_type {};
+}  // namespace detail
+
+// True for statements whose SQL text depends on their type only, e.g.
+// statements built from tables, columns and parameters.
+template <typename T>
+constexpr auto is_sql_string_cacheable_v =
+    not detail::has_runtime_sql_text<T>::value;
+
+// Returns the SQL text of a statement. For statements whose text depends on
+// their type only, the text is serialized once per statement and context type
+// and shared by all threads afterwards. Other statements are serialized on
+// each call.
+//
+//   const auto& sql = to_sql_string_cached(context_t{}, statement);
+template <typename Context, typename T>
+[[nodiscard]] decltype(auto) to_sql_string_cached(const Context& context,
+                                                  const T& t) {
+  if constexpr (is_sql_string_cacheable_v<T>) {
+    static const auto sql = to_sql_string_c(context, t);
+    return (sql);
+  } else {
+    return to_sql_string_c(context, t);
+  }
+}
+}  // namespace sqlpp
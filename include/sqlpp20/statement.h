@@ -30,7 +30,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlpp20/array_unique.h>
 #include <sqlpp20/bad_expression.h>
 #include <sqlpp20/clause_fwd.h>
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/detail/statement_constructor_arg.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/succeeded.h>
 #include <sqlpp20/type_traits.h>
 #include <sqlpp20/wrapped_static_assert.h>
@@ -129,18 +131,20 @@ class statement : public clause_base<Clauses, statement<Clauses...>>... {
 };
 
 template <typename Clause, typename... Clauses>
-auto clause_of(const statement<Clauses...>& s) {
+constexpr auto clause_of(const statement<Clauses...>& s) {
   return static_cast<const clause_base<Clause, statement<Clauses...>>&>(s);
 }
 
 template <typename Clause, typename... Clauses>
-auto statement_of(const clause_base<Clause, statement<Clauses...>>& base) {
+constexpr auto statement_of(
+    const clause_base<Clause, statement<Clauses...>>& base) {
   return static_cast<const statement<Clauses...>&>(base);
 }
 
 template <typename OldClause, typename... Clauses, typename NewClause>
-auto new_statement(const clause_base<OldClause, statement<Clauses...>>& oldBase,
-                   NewClause newClause) {
+constexpr auto new_statement(
+    const clause_base<OldClause, statement<Clauses...>>& oldBase,
+    NewClause newClause) {
   const auto& old_statement = statement_of(oldBase);
   return statement<std::conditional_t<std::is_same_v<Clauses, OldClause>,
                                       NewClause, Clauses>...>{
@@ -178,13 +182,23 @@ constexpr auto check_statement_clauses() {
 }
 
 template <typename Context, typename... Clauses>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const statement<Clauses...>& t) {
-  return (
-      std::string{} + ... +
-      to_sql_string(
-          context,
-          static_cast<const clause_base<Clauses, statement<Clauses...>>&>(t)));
+constexpr auto serialize(Context& context, std::string& sql,
+                         const statement<Clauses...>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  (serialize(
+       context, sql,
+       static_cast<const clause_base<Clauses, statement<Clauses...>>&>(t)),
+   ...);
+}
+
+template <typename Context, typename... Clauses>
+auto sql_length_estimate(const Context& context,
+                         const statement<Clauses...>& t) -> std::size_t {
+  return (std::size_t{0} + ... +
+          sql_length_estimate(
+              context,
+              static_cast<const clause_base<Clauses, statement<Clauses...>>&>(
+                  t)));
 }
 
 template <typename... LClauses, typename... RClauses>
@@ -193,10 +207,10 @@ constexpr auto operator<<(statement<LClauses...> l, statement<RClauses...> r) {
   if constexpr (_check) {
     // remove non-clauses from left part
     using clauses_t =
-        decltype((type_vector<>{} + ... +
-                  std::conditional_t<is_clause_v<LClauses>,
-                                     type_vector<LClauses>, type_vector<>>{}) +
-                 type_vector<RClauses...>{});
+        type_vector_cat_t<std::conditional_t<is_clause_v<LClauses>,
+                                             type_vector<LClauses>,
+                                             type_vector<>>...,
+                          type_vector<RClauses...>>;
     return algorithm::copy_t<clauses_t, statement>(
         detail::statement_constructor_arg(l, r));
   } else {
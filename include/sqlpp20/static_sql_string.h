@@ -0,0 +1,87 @@
+#pragma once
+
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/to_sql_string.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace sqlpp {
+// Fixed-size, null-terminated character storage that can be used as the value
+// of a constexpr variable (and therefore ends up in read-only data).
+template <std::size_t Size>
+struct fixed_string {
+  char _data[Size + 1] = {};
+
+  [[nodiscard]] static constexpr auto size() -> std::size_t { return Size; }
+
+  [[nodiscard]] constexpr auto c_str() const -> const char* { return _data; }
+
+  [[nodiscard]] constexpr operator std::string_view() const {
+    return std::string_view{_data, Size};
+  }
+};
+
+namespace detail {
+template <typename Context, const auto& Statement>
+constexpr auto serialize_statically() -> std::string {
+  auto context = Context{};
+  auto sql = std::string{};
+  serialize(context, sql, Statement);
+  return sql;
+}
+
+template <typename Context, const auto& Statement>
+consteval auto make_static_sql_string() {
+  // The std::string used during constant evaluation cannot outlive it, so the
+  // statement is serialized twice: once for the size and once for the text.
+  constexpr auto size = serialize_statically<Context, Statement>().size();
+  auto text = fixed_string<size>{};
+  const auto sql = serialize_statically<Context, Statement>();
+  std::copy(sql.begin(), sql.end(), text._data);
+  return text;
+}
+}  // namespace detail
+
+// The SQL text of a statement, generated at compile time for the given
+// context. The statement has to be a constexpr object with static storage
+// duration, e.g.
+//
+//   static constexpr auto s =
+//       select(tab.id).from(tab).where(tab.id == parameter<int64_t>(tab.id));
+//   const std::string_view sql = static_sql_string_v<context_t, s>;
+//
+// Statements that are built from columns, tables and parameters qualify.
+// Statements with runtime values do not (and fail to compile).
+template <typename Context, const auto& Statement>
+inline constexpr auto static_sql_string_v =
+    detail::make_static_sql_string<Context, Statement>();
+}  // namespace sqlpp
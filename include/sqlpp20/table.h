@@ -27,8 +27,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <sqlpp20/char_sequence.h>
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/join.h>
 #include <sqlpp20/member.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/table_alias.h>
 #include <sqlpp20/table_columns.h>
 #include <sqlpp20/to_sql_name.h>
@@ -71,9 +73,16 @@ struct table_spec_of<table_t<TableSpec>> {
 };
 
 template <typename Context, typename TableSpec>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const table_t<TableSpec>& t) {
-  return to_sql_name(context, t);
+constexpr auto serialize(Context& context, std::string& sql,
+                         const table_t<TableSpec>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += to_sql_name(context, t);
+}
+
+template <typename Context, typename TableSpec>
+auto sql_length_estimate(const Context& context, const table_t<TableSpec>& t)
+    -> std::size_t {
+  return to_sql_name(context, t).size();
 }
 
 template <typename TableSpec>
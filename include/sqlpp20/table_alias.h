@@ -28,8 +28,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <sqlpp20/char_sequence.h>
 #include <sqlpp20/column.h>
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/join.h>
 #include <sqlpp20/member.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/table_columns.h>
 #include <sqlpp20/table_spec.h>
 #include <sqlpp20/to_sql_name.h>
@@ -86,17 +88,25 @@ template <typename Table, typename AliasTableSpec, typename TableSpec>
 
 template <typename Context, typename Table, typename AliasTableSpec,
           typename TableSpec>
-[[nodiscard]] auto to_sql_string(
-    Context& context,
-    const table_alias_t<Table, AliasTableSpec, TableSpec>& t) {
-  auto ret = std::string{};
-
-  if constexpr (requires_braces_v<Table>) ret += "(";
-  ret += to_sql_string(t._table);
-  if constexpr (requires_braces_v<Table>) ret += ")";
-  ret += " AS " + to_sql_name(t);
+constexpr auto serialize(
+    Context& context, std::string& sql,
+    const table_alias_t<Table, AliasTableSpec, TableSpec>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  if constexpr (requires_braces_v<Table>) sql += "(";
+  serialize(context, sql, t._table);
+  if constexpr (requires_braces_v<Table>) sql += ")";
+  sql += " AS ";
+  sql += to_sql_name(context, t);
+}
 
-  return ret;
+template <typename Context, typename Table, typename AliasTableSpec,
+          typename TableSpec>
+auto sql_length_estimate(
+    const Context& context,
+    const table_alias_t<Table, AliasTableSpec, TableSpec>& t) -> std::size_t {
+  return (requires_braces_v<Table> ? 2 : 0) +
+         sql_length_estimate(context, t._table) + sql_length(" AS ") +
+         to_sql_name(context, t).size();
 }
 
 }  // namespace sqlpp
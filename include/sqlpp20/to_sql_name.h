@@ -28,14 +28,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <sqlpp20/type_traits.h>
 
-#include <string>
+#include <string_view>
 
 namespace sqlpp {
 template <typename Context, typename Object>
-[[nodiscard]] auto to_sql_name(Context& context, const Object& object)
-    -> std::string {
+[[nodiscard]] constexpr auto to_sql_name(Context& context,
+                                         const Object& object)
+    -> std::string_view {
   if constexpr (not std::is_same_v<name_tag_of_t<Object>, none_t>) {
-    return std::string(name_tag_of_t<Object>::name);
+    return name_tag_of_t<Object>::name;
   } else {
     static_assert(wrong<Object>,
                   "to_sql_name() is expecting a named expression (e.g. column, "
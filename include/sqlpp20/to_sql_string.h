@@ -26,47 +26,168 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/escape.h>
+#include <sqlpp20/detail/serialize_custom.h>
 #include <sqlpp20/exception.h>
+#include <sqlpp20/literal_parameters.h>
+#include <sqlpp20/sql_length_estimate.h>
+#include <utility>
 
+#include <array>
+#include <charconv>
 #include <cmath>
-#include <iomanip>
+#include <cstdint>
+#include <limits>
 #include <optional>
-#include <sstream>
+#include <span>
 #include <string>
+#include <string_view>
+#include <vector>
+
+namespace sqlpp::detail {
+// std::to_string is not constexpr, so the digits are written by hand (right to
+// left) to keep parameter numbering usable at compile time.
+template <typename T>
+constexpr auto serialize_integral(std::string& sql, const T& i) -> void {
+  auto digits = std::array<char, std::numeric_limits<T>::digits10 + 1>{};
+  auto begin = digits.size();
+  auto rest = i;
+  do {
+    const auto digit = rest % 10;
+    digits[--begin] = static_cast<char>('0' + (digit < 0 ? -digit : digit));
+    rest /= 10;
+  } while (rest != 0);
+  if (i < 0) sql.push_back('-');
+  sql.append(digits.data() + begin, digits.size() - begin);
+}
+}  // namespace sqlpp::detail
 
 namespace sqlpp {
-template <typename Context, typename T>
-[[nodiscard]] auto to_sql_string(Context& context, const std::optional<T>& o) {
-  return o ? to_sql_string(context, o.value()) : "NULL";
+// serialize() appends the SQL representation of an object to `sql`. All
+// expressions, clauses and statements provide an overload, so that a whole
+// statement is written into a single buffer. Connectors customize the output
+// by overloading serialize() for their context type. Overloads of
+// to_sql_string(context, t) for a specific context or object type are still
+// honored (see detail::serialize_custom).
+template <typename Context>
+constexpr auto serialize(Context& context, std::string& sql,
+                         const std::nullopt_t& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  sql += "NULL";
+}
+
+template <typename Context>
+auto sql_length_estimate(const Context&, const std::nullopt_t&)
+    -> std::size_t {
+  return sql_length("NULL");
+}
+
+template <typename Context>
+constexpr auto serialize(Context& context, std::string& sql,
+                         const char& c) -> void {
+  if (detail::serialize_custom(context, sql, c)) return;
+  sql.push_back(c);
+}
+
+template <typename Context>
+auto sql_length_estimate(const Context&, const char&) -> std::size_t {
+  return 1;
 }
 
 template <typename Context>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 [[maybe_unused]] const std::nullopt_t&) {
-  return "NULL";
+constexpr auto serialize(Context& context, std::string& sql,
+                         const std::string_view& s) -> void {
+  if (detail::serialize_custom(context, sql, s)) return;
+  if (detail::serialize_lifted_literal(context, sql, s)) return;
+  detail::serialize_escaped<'\''>(sql, s);
 }
 
 template <typename Context>
-[[nodiscard]] auto to_sql_string(Context& context, const char& c) {
-  return std::string(1, c);
+auto sql_length_estimate(const Context&, const std::string_view& s)
+    -> std::size_t {
+  return s.size() + 2;
 }
 
 template <typename Context>
-[[nodiscard]] auto to_sql_string(Context& context, const std::string_view& s) {
-  auto ret = std::string{"'"};
-  for (const auto c : s) {
-    if (c == '\'') ret.push_back(c);  // Escaping
-    ret.push_back(c);
+auto sql_length_estimate(const Context& context, const char* const& s)
+    -> std::size_t {
+  return sql_length_estimate(context, std::string_view{s});
+}
+
+template <typename Context>
+auto sql_length_estimate(const Context& context, const std::string& s)
+    -> std::size_t {
+  return sql_length_estimate(context, std::string_view{s});
+}
+
+// Blob literals in hex notation (X'..'), as understood by SQLite and MySQL
+template <typename Context>
+constexpr auto serialize(Context& context, std::string& sql,
+                         const std::span<const std::uint8_t>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  constexpr auto digits = std::string_view{"0123456789ABCDEF"};
+  sql += "X'";
+  for (const auto byte : t) {
+    sql += digits[byte >> 4];
+    sql += digits[byte & 0x0F];
+  }
+  sql += "'";
+}
+
+template <typename Context>
+constexpr auto serialize(Context& context, std::string& sql,
+                         const std::vector<std::uint8_t>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  serialize(context, sql, std::span<const std::uint8_t>{t});
+}
+
+template <typename Context>
+auto sql_length_estimate(const Context&,
+                         const std::span<const std::uint8_t>& t)
+    -> std::size_t {
+  return sql_length("X''") + 2 * t.size();
+}
+
+template <typename Context>
+auto sql_length_estimate(const Context& context,
+                         const std::vector<std::uint8_t>& t) -> std::size_t {
+  return sql_length_estimate(context, std::span<const std::uint8_t>{t});
+}
+
+template <typename Context, typename T>
+requires(std::is_integral_v<T>) constexpr auto serialize(Context& context,
+                                                         std::string& sql,
+                                                         const T& i) -> void {
+  if (detail::serialize_custom(context, sql, i)) return;
+  if constexpr (std::is_same_v<T, bool>) {
+    if (detail::serialize_lifted_literal(context, sql, i)) return;
+    sql.push_back(i ? '1' : '0');
+  } else {
+    // Unsigned values beyond the range of int64_t stay in the SQL text
+    if (std::in_range<std::int64_t>(i) and
+        detail::serialize_lifted_literal(context, sql,
+                                         static_cast<std::int64_t>(i))) {
+      return;
+    }
+    detail::serialize_integral(sql, i);
   }
-  ret.push_back('\'');
-  return ret;
 }
 
 template <typename Context, typename T>
-requires(std::is_integral_v<T>)
-    [[nodiscard]] auto to_sql_string(Context& context, const T& i)
-        -> std::string {
-  return std::to_string(i);
+requires(std::is_integral_v<T>) auto sql_length_estimate(
+    const Context&, const T& i) -> std::size_t {
+  if constexpr (std::is_same_v<T, bool>) {
+    return 1;
+  } else {
+    auto length = std::size_t{1};
+    if constexpr (std::is_signed_v<T>) {
+      if (i < 0) ++length;
+    }
+    for (auto rest = i / 10; rest != 0; rest /= 10) {
+      ++length;
+    }
+    return length;
+  }
 }
 
 template <typename Context>
@@ -88,23 +209,63 @@ template <typename Context>
 }
 
 template <typename Context, typename T>
-requires(std::is_floating_point_v<T>)
-    [[nodiscard]] auto to_sql_string(Context& context, const T& f)
-        -> std::string {
+requires(std::is_floating_point_v<T>) constexpr auto serialize(Context& context,
+                                                               std::string& sql,
+                                                               const T& f)
+    -> void {
+  if (detail::serialize_custom(context, sql, f)) return;
   if (std::isnan(f)) {
-    return nan_to_sql_string(context);
+    sql += nan_to_sql_string(context);
   } else if (std::isinf(f)) {
-    return f > std::numeric_limits<T>::max() ? inf_to_sql_string(context)
+    sql += f > std::numeric_limits<T>::max() ? inf_to_sql_string(context)
                                              : neg_inf_to_sql_string(context);
+  } else if (detail::serialize_lifted_literal(context, sql,
+                                              static_cast<double>(f))) {
+    return;
+  } else {
+    // Shortest representation that reads back as the same value. Unlike
+    // streams, to_chars ignores the global locale.
+    auto chars = std::array<char, 64>{};
+    const auto result =
+        std::to_chars(chars.data(), chars.data() + chars.size(), f);
+    sql.append(chars.data(), result.ptr);
+  }
+}
+
+template <typename Context, typename T>
+requires(std::is_floating_point_v<T>) auto sql_length_estimate(
+    const Context&, const T&) -> std::size_t {
+  // Upper bound: all significant digits plus sign, point and exponent
+  return std::numeric_limits<T>::max_digits10 + 8;
+}
+
+template <typename Context, typename T>
+constexpr auto serialize(Context& context, std::string& sql,
+                         const std::optional<T>& o) -> void {
+  if (detail::serialize_custom(context, sql, o)) return;
+  if (o) {
+    serialize(context, sql, o.value());
   } else {
-    // TODO: Once gcc and clang support to_chars, try that
-    auto oss = std::ostringstream{};
-    oss << std::setprecision(std::numeric_limits<long double>::digits10 + 1)
-        << f;
-    return oss.str();
+    sql += "NULL";
   }
 }
 
+template <typename Context, typename T>
+auto sql_length_estimate(const Context& context, const std::optional<T>& o)
+    -> std::size_t {
+  return o ? sql_length_estimate(context, o.value()) : sql_length("NULL");
+}
+
+// Compatibility shim for code that wants the SQL representation of a single
+// object as a string of its own.
+template <typename Context, typename T>
+[[nodiscard]] auto to_sql_string(Context& context, const T& t) -> std::string {
+  auto sql = std::string{};
+  sql.reserve(sql_length_estimate(context, t));
+  serialize(context, sql, t);
+  return sql;
+}
+
 // This version will bind to a temporary context, all others won't
 template <typename Context, typename T>
 [[nodiscard]] auto to_sql_string_c(Context context, const T& t) {
@@ -29,24 +29,52 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlpp20/to_sql_string.h>
 
 #include <string>
+#include <string_view>
 #include <tuple>
 
 namespace sqlpp ::detail {
 template <typename Context, typename... Ts, std::size_t... Is>
-[[nodiscard]] auto tuple_to_sql_string_impl(
-    Context& context, const std::string& separator, const std::tuple<Ts...>& t,
-    std::integer_sequence<std::size_t, Is...>) {
-  return (std::string{} + ... +
-          ((Is ? separator : "") + to_sql_string(context, std::get<Is>(t))));
+constexpr auto serialize_tuple_impl(Context& context, std::string& sql,
+                                    const std::string_view& separator,
+                                    const std::tuple<Ts...>& t,
+                                    std::integer_sequence<std::size_t, Is...>)
+    -> void {
+  ((sql += (Is ? separator : ""), serialize(context, sql, std::get<Is>(t))),
+   ...);
 }
 }  // namespace sqlpp::detail
 
 namespace sqlpp {
 template <typename Context, typename... Ts>
-[[nodiscard]] auto tuple_to_sql_string(Context& context,
-                                       const std::string& separator,
-                                       const std::tuple<Ts...>& t) {
-  return detail::tuple_to_sql_string_impl(
-      context, separator, t, std::make_index_sequence<sizeof...(Ts)>());
+constexpr auto serialize_tuple(Context& context, std::string& sql,
+                               const std::string_view& separator,
+                               const std::tuple<Ts...>& t) -> void {
+  detail::serialize_tuple_impl(context, sql, separator, t,
+                               std::make_index_sequence<sizeof...(Ts)>());
+}
+
+template <typename Context, typename... Ts>
+auto sql_length_estimate_tuple(const Context& context,
+                               const std::string_view& separator,
+                               const std::tuple<Ts...>& t) -> std::size_t {
+  if constexpr (sizeof...(Ts) == 0) {
+    return 0;
+  } else {
+    return std::apply(
+        [&](const auto&... elements) {
+          return ((separator.size() * (sizeof...(Ts) - 1)) + ... +
+                  sql_length_estimate(context, elements));
+        },
+        t);
+  }
+}
+
+template <typename Context, typename... Ts>
+[[nodiscard]] constexpr auto tuple_to_sql_string(
+    Context& context, const std::string_view& separator,
+    const std::tuple<Ts...>& t) {
+  auto sql = std::string{};
+  serialize_tuple(context, sql, separator, t);
+  return sql;
 }
 }  // namespace sqlpp
@@ -26,6 +26,8 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/unique_types.h>
+
 #include <type_traits>
 #include <utility>
 
@@ -66,6 +68,64 @@ struct _type_set {
   }
 };
 
+// Concatenates the elements of sets, without instantiating intermediate sets
+// (and their bases) like repeated insert() does. The result is a set if the
+// arguments are disjoint.
+template <typename... Sets>
+struct _type_set_cat {
+  using type = _type_set<>;
+};
+
+template <typename... Ts>
+struct _type_set_cat<_type_set<Ts...>> {
+  using type = _type_set<Ts...>;
+};
+
+template <typename... T1s, typename... T2s, typename... Rest>
+struct _type_set_cat<_type_set<T1s...>, _type_set<T2s...>, Rest...> {
+  using type =
+      typename _type_set_cat<_type_set<T1s..., T2s...>, Rest...>::type;
+};
+
+template <typename... T1s, typename... T2s, typename... T3s, typename... T4s,
+          typename... Rest>
+struct _type_set_cat<_type_set<T1s...>, _type_set<T2s...>, _type_set<T3s...>,
+                     _type_set<T4s...>, Rest...> {
+  using type = typename _type_set_cat<_type_set<T1s..., T2s..., T3s..., T4s...>,
+                                      Rest...>::type;
+};
+
+template <typename... Sets>
+using _type_set_cat_t = typename _type_set_cat<Sets...>::type;
+
+// Most callers pass distinct types. This is checked in a single step, and
+// only sets with duplicates are built element by element.
+template <bool Unique, typename... Ts>
+struct _make_type_set {
+  using type = _type_set<Ts...>;
+};
+
+template <typename... Ts>
+struct _make_type_set<false, Ts...> {
+  using type = decltype((_type_set<>{} << ... << _base<Ts>{}));
+};
+
+template <typename... Ts>
+using _make_type_set_t =
+    typename _make_type_set<unique_types_v<Ts...>, Ts...>::type;
+
+template <typename Elements>
+struct _type_set_of_elements;
+
+template <typename... Ts>
+struct _type_set_of_elements<_type_set<Ts...>> {
+  using type = _make_type_set_t<Ts...>;
+};
+
+template <typename... Sets>
+using _type_set_union_t =
+    typename _type_set_of_elements<_type_set_cat_t<Sets...>>::type;
+
 template <typename... Ls, typename R>
 [[nodiscard]] constexpr auto operator<<(_type_set<Ls...> lhs, _base<R>) {
   return lhs.template insert<R>();
@@ -86,7 +146,7 @@ template <typename... Ls, typename... Rs>
 template <typename... Ls, typename... Rs>
 [[nodiscard]] constexpr auto operator==(_type_set<Ls...> lhs,
                                         _type_set<Rs...> rhs) {
-  return rhs <= lhs && lhs <= rhs;
+  return sizeof...(Ls) == sizeof...(Rs) && lhs >= rhs;
 }
 
 template <typename... Ls, typename... Rs>
@@ -97,46 +157,54 @@ template <typename... Ls, typename... Rs>
 
 template <typename... Ls, typename... Rs>
 [[nodiscard]] constexpr auto operator|(_type_set<Ls...> lhs,
-                                       _type_set<Rs...> rhs) {
-  return (lhs << ... << _base<Rs>{});
+                                       _type_set<Rs...>) {
+  return _type_set_cat_t<_type_set<Ls...>,
+                         std::conditional_t<lhs.template count<Rs>(),
+                                            _type_set<>, _type_set<Rs>>...>{};
 }
 
 template <typename... Ls, typename... Rs>
 [[nodiscard]] constexpr auto operator&(_type_set<Ls...> lhs, _type_set<Rs...>) {
-  return (_type_set<>{} | ... |
-          std::conditional_t<lhs.template count<Rs>(), _type_set<Rs>,
-                             _type_set<>>{});
+  return _type_set_cat_t<std::conditional_t<lhs.template count<Rs>(),
+                                            _type_set<Rs>, _type_set<>>...>{};
 }
 
 template <typename... Ls, typename... Rs>
 [[nodiscard]] constexpr auto operator-(_type_set<Ls...>, _type_set<Rs...> rhs) {
-  return (_type_set<>{} | ... |
-          std::conditional_t<rhs.template count<Ls>(), _type_set<>,
-                             _type_set<Ls>>{});
+  return _type_set_cat_t<std::conditional_t<rhs.template count<Ls>(),
+                                            _type_set<>, _type_set<Ls>>...>{};
 }
 
+// Symmetric difference: the elements that are in exactly one of the sets.
 template <typename... Ls, typename... Rs>
 [[nodiscard]] constexpr auto operator^(_type_set<Ls...> lhs,
                                        _type_set<Rs...> rhs) {
-  return (lhs | rhs) - (rhs & rhs);
+  return (lhs | rhs) - (lhs & rhs);
 }
 }  // namespace detail
 
 template <typename... Ts>
 constexpr auto type_set() {
-  return (detail::_type_set<>{} << ... << detail::_base<Ts>{});
+  return detail::_make_type_set_t<Ts...>{};
 }
 
 template <typename T, typename... Ts>
 constexpr auto type_set(const T&, const Ts&...) {
-  return (detail::_type_set<T>{} << ... << detail::_base<Ts>{});
+  return detail::_make_type_set_t<T, Ts...>{};
 }
 
 template <template <typename> typename Condition, typename... Ts>
 constexpr auto type_set_if() {
-  return (detail::_type_set<>{} | ... |
-          std::conditional_t<Condition<Ts>::value, detail::_type_set<Ts>,
-                             detail::_type_set<>>{});
+  return detail::_type_set_union_t<
+      std::conditional_t<Condition<Ts>::value, detail::_type_set<Ts>,
+                         detail::_type_set<>>...>{};
+}
+
+// Union of any number of sets, e.g. of the sets of all nodes of an
+// expression. Prefer this over folding with operator|.
+template <typename... Sets>
+constexpr auto type_set_union(const Sets&...) {
+  return detail::_type_set_union_t<Sets...>{};
 }
 
 template <template <typename> typename Transform, typename... Ts>
@@ -35,10 +35,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <cstdint>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace sqlpp {
 struct default_value_t;
@@ -427,17 +429,17 @@ template <typename T>
 using add_optional_t = typename add_optional<T>::type;
 
 template <typename T>
-decltype(auto) get_value(const T& t) {
+constexpr decltype(auto) get_value(const T& t) {
   return t;
 }
 
 template <typename T>
-decltype(auto) get_value(const std::optional<T>& t) {
+constexpr decltype(auto) get_value(const std::optional<T>& t) {
   return t.value();
 }
 
 template <typename T>
-auto has_value(const T& t) -> bool {
+constexpr auto has_value(const T& t) -> bool {
   if constexpr (sqlpp::is_optional_v<T>) {
     return t.has_value();
   }
@@ -528,6 +530,23 @@ constexpr auto has_text_value_v =
     is_text_v<remove_optional_t<T>> or
     is_text_v<remove_optional_t<value_type_of_t<T>>>;
 
+template <typename T>
+constexpr auto is_blob_v = false;
+
+template <>
+constexpr auto is_blob_v<std::span<const std::uint8_t>> = true;
+
+template <>
+constexpr auto is_blob_v<std::vector<std::uint8_t>> = true;
+
+template <>
+constexpr auto is_blob_v<std::nullopt_t> = true;
+
+template <typename T>
+constexpr auto has_blob_value_v =
+    is_blob_v<remove_optional_t<T>> or
+    is_blob_v<remove_optional_t<value_type_of_t<T>>>;
+
 template <typename T>
 constexpr auto is_conditionless_dynamic_join = false;
 
@@ -553,7 +572,7 @@ using parameters_of_t = std::decay_t<decltype(parameters_of<T>::value)>;
 
 template <typename... T>
 struct parameters_of<type_vector<T...>> {
-  static constexpr auto value = (type_vector<>{} + ... + parameters_of_v<T>);
+  static constexpr auto value = type_vector_cat_t<parameters_of_t<T>...>{};
 };
 
 template <typename... ProvidedTables, typename... Nodes>
@@ -571,7 +590,7 @@ template <typename... ProvidedTables, typename T>
 
 template <typename... T>
 [[nodiscard]] constexpr auto provided_tables_of(type_vector<T...>) {
-  return (type_vector<>{} + ... + provided_tables_of(type_t<T>{}));
+  return type_vector_cat_t<decltype(provided_tables_of(type_t<T>{}))...>{};
 }
 
 template <typename T>
@@ -584,7 +603,7 @@ constexpr auto provided_tables_of_v = provided_tables_of(type_t<T>{});
 
 template <typename... T>
 [[nodiscard]] constexpr auto required_ctes_of(type_vector<T...>) {
-  return (type_set() | ... | required_ctes_of(type_t<T>{}));
+  return type_set_union(required_ctes_of(type_t<T>{})...);
 }
 
 template <typename T>
@@ -597,7 +616,7 @@ constexpr auto required_ctes_of_v = required_ctes_of(type_t<T>{});
 
 template <typename... T>
 [[nodiscard]] constexpr auto provided_ctes_of(type_vector<T...>) {
-  return (type_set() | ... | provided_ctes_of(type_t<T>{}));
+  return type_set_union(provided_ctes_of(type_t<T>{})...);
 }
 
 template <typename T>
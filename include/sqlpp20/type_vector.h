@@ -58,4 +58,34 @@ template <typename... Ls, typename... Rs>
                                        [[maybe_unused]] type_vector<Rs...>) {
   return type_vector<Ls..., Rs...>{};
 }
+
+// Concatenates any number of type vectors. Prefer this over folding with
+// operator+, which has to resolve the overloaded operator at each step
+// (including the constrained operator+ for SQL expressions).
+template <typename... Vectors>
+struct type_vector_cat {
+  using type = type_vector<>;
+};
+
+template <typename... Ts>
+struct type_vector_cat<type_vector<Ts...>> {
+  using type = type_vector<Ts...>;
+};
+
+template <typename... T1s, typename... T2s, typename... Rest>
+struct type_vector_cat<type_vector<T1s...>, type_vector<T2s...>, Rest...> {
+  using type =
+      typename type_vector_cat<type_vector<T1s..., T2s...>, Rest...>::type;
+};
+
+template <typename... T1s, typename... T2s, typename... T3s, typename... T4s,
+          typename... Rest>
+struct type_vector_cat<type_vector<T1s...>, type_vector<T2s...>,
+                       type_vector<T3s...>, type_vector<T4s...>, Rest...> {
+  using type = typename type_vector_cat<
+      type_vector<T1s..., T2s..., T3s..., T4s...>, Rest...>::type;
+};
+
+template <typename... Vectors>
+using type_vector_cat_t = typename type_vector_cat<Vectors...>::type;
 }  // namespace sqlpp
@@ -28,11 +28,22 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <sqlpp20/to_sql_name.h>
 
+#include <string>
+
 namespace sqlpp {
 template <typename Context, typename FirstColumnSpec, typename... ColumnSpecs>
+constexpr auto serialize_names(
+    Context& context, std::string& sql,
+    sqlpp::type_vector<FirstColumnSpec, ColumnSpecs...>) -> void {
+  sql += to_sql_name(context, FirstColumnSpec{});
+  ((sql += ", ", sql += to_sql_name(context, ColumnSpecs{})), ...);
+}
+
+template <typename Context, typename... ColumnSpecs>
 [[nodiscard]] constexpr auto type_vector_to_sql_name(
-    Context& context, sqlpp::type_vector<FirstColumnSpec, ColumnSpecs...>) {
-  return (to_sql_name(context, FirstColumnSpec{}) + ... +
-          (", " + to_sql_name(context, ColumnSpecs{})));
+    Context& context, sqlpp::type_vector<ColumnSpecs...> t) {
+  auto sql = std::string{};
+  serialize_names(context, sql, t);
+  return sql;
 }
 }  // namespace sqlpp
@@ -26,6 +26,8 @@ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <sqlpp20/detail/serialize_custom.h>
+#include <sqlpp20/sql_length_estimate.h>
 #include <sqlpp20/type_traits.h>
 
 #include <string>
@@ -74,8 +76,15 @@ requires(std::is_arithmetic_v<Expression>)
 }
 
 template <typename Context, typename Expression>
-[[nodiscard]] auto to_sql_string(Context& context,
-                                 const value_t<Expression>& t) {
-  return to_sql_string(context, t._expression);
+constexpr auto serialize(Context& context, std::string& sql,
+                         const value_t<Expression>& t) -> void {
+  if (detail::serialize_custom(context, sql, t)) return;
+  serialize(context, sql, t._expression);
+}
+
+template <typename Context, typename Expression>
+auto sql_length_estimate(const Context& context, const value_t<Expression>& t)
+    -> std::size_t {
+  return sql_length_estimate(context, t._expression);
 }
 }  // namespace sqlpp
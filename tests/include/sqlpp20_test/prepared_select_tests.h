@@ -30,11 +30,20 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <sqlpp20/clause/insert_into.h>
 #include <sqlpp20/clause/select.h>
 #include <sqlpp20/function.h>
+#include <sqlpp20/parameter.h>
 #include <sqlpp20_test/tables/TabDepartment.h>
 
 #include <iostream>
 
 namespace sqlpp::test {
+namespace {
+constexpr auto select_department_by_id =
+    sqlpp::select(::test::tabDepartment.id, ::test::tabDepartment.name)
+        .from(::test::tabDepartment)
+        .where(::test::tabDepartment.id ==
+               sqlpp::parameter<int64_t>(::test::tabDepartment.id));
+}  // namespace
+
 template <typename Db>
 auto prepared_select_tests(Db& db) -> void {
   db(drop_table(::test::tabDepartment));
@@ -55,6 +64,13 @@ auto prepared_select_tests(Db& db) -> void {
       std::cout << row.id << ", " << row.name.value_or("NULL") << std::endl;
     }
   }
+
+  // Statements with SQL text generated at compile time
+  auto static_select = db.template prepare<select_department_by_id>();
+  static_select.parameters.id = id;
+  for (const auto& row : execute(static_select)) {
+    std::cout << row.id << ", " << row.name.value_or("NULL") << std::endl;
+  }
 #warning : Add some more tests...
 }
 }  // namespace sqlpp::test
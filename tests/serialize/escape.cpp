@@ -0,0 +1,84 @@
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/detail/escape.h>
+#include <sqlpp20/to_sql_string.h>
+#include <sqlpp20_test/mock_db.h>
+
+#include "assert_equality.h"
+
+using ::sqlpp::test::assert_equality;
+using ::sqlpp::test::mock_context_t;
+
+namespace {
+auto escape_char_by_char(const std::string_view& text,
+                         const std::string_view& specials) {
+  auto sql = std::string{"'"};
+  for (const auto c : text) {
+    if (specials.find(c) != specials.npos) sql.push_back(c);
+    sql.push_back(c);
+  }
+  sql.push_back('\'');
+  return sql;
+}
+
+// Literals are escaped at compile time, too
+static_assert([] {
+  auto sql = std::string{};
+  sqlpp::detail::serialize_escaped<'\''>(sql, "O'Neil");
+  return sql == "'O''Neil'";
+}());
+}  // namespace
+
+int main() {
+  try {
+    assert_equality("''", to_sql_string_c(mock_context_t{}, ""));
+    assert_equality("''''", to_sql_string_c(mock_context_t{}, "'"));
+    assert_equality("'O''Neil'", to_sql_string_c(mock_context_t{}, "O'Neil"));
+    assert_equality("'\\'", to_sql_string_c(mock_context_t{}, "\\"));
+
+    // Specials in every position, across the boundaries of 16 and 32 byte
+    // blocks
+    for (auto size = std::size_t{0}; size < 100; ++size) {
+      for (auto pos = std::size_t{0}; pos < size; ++pos) {
+        auto text = std::string(size, 'x');
+        text[pos] = '\'';
+        if (pos + 17 < size) text[pos + 17] = '\\';
+        if (pos + 33 < size) text[pos + 33] = '\'';
+
+        assert_equality(escape_char_by_char(text, "'"),
+                        to_sql_string_c(mock_context_t{}, text));
+
+        auto sql = std::string{"prefix "};
+        sqlpp::detail::serialize_escaped<'\'', '\\'>(sql, text);
+        assert_equality("prefix " + escape_char_by_char(text, "'\\"), sql);
+      }
+    }
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return -1;
+  }
+}
@@ -66,6 +66,21 @@ int main() {
         "0.123456789012345",
         to_sql_string_c(mock_context_t{}, 0.1234567890123456789).substr(0, 17));
 
+    // Shortest representation that reads back as the same value
+    assert_equality("0.1", to_sql_string_c(mock_context_t{}, 0.1f));
+    assert_equality("0.1", to_sql_string_c(mock_context_t{}, 0.1));
+    assert_equality("-2.5", to_sql_string_c(mock_context_t{}, -2.5));
+    assert_equality("1e+20", to_sql_string_c(mock_context_t{}, 1e20));
+    assert_equality("0.30000000000000004",
+                    to_sql_string_c(mock_context_t{}, 0.1 + 0.2));
+    for (const auto d : {0.1234567890123456789, 1.0 / 3.0, 6.02214076e23,
+                         -1.602176634e-19, std::numeric_limits<double>::max(),
+                         std::numeric_limits<double>::min()}) {
+      if (std::stod(to_sql_string_c(mock_context_t{}, d)) != d) {
+        throw std::logic_error("double did not survive a round trip");
+      }
+    }
+
     if constexpr (std::numeric_limits<float>::is_iec559) {
       test_nan(std::nanf(""));
       test_inf(std::numeric_limits<float>::infinity());
@@ -79,5 +94,6 @@ int main() {
     }
   } catch (const std::exception& e) {
     std::cerr << "Exception: " << e.what() << "\n";
+    return -1;
   }
 }
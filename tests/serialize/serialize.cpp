@@ -0,0 +1,91 @@
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/delete_from.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/operator.h>
+#include <sqlpp20_test/mock_db.h>
+#include <sqlpp20_test/tables/TabDepartment.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "assert_equality.h"
+
+using ::sqlpp::test::assert_equality;
+using ::sqlpp::test::mock_context_t;
+using test::tabDepartment;
+using test::tabPerson;
+
+int main() {
+  try {
+    auto context = mock_context_t{};
+
+    // serialize() appends to the buffer it is given
+    {
+      auto sql = std::string{"EXPLAIN "};
+      serialize(context, sql,
+                sqlpp::select(tabPerson.id)
+                    .from(tabPerson)
+                    .where(tabPerson.name == "O'Neil")
+                    .order_by(tabPerson.id.asc())
+                    .limit(10u)
+                    .offset(20u));
+      assert_equality(
+          "EXPLAIN SELECT tab_person.id FROM tab_person WHERE "
+          "tab_person.name = 'O''Neil' ORDER BY tab_person.id ASC LIMIT 10 "
+          "OFFSET 20",
+          sql);
+    }
+
+    // several statements can share one buffer
+    {
+      auto sql = std::string{};
+      serialize(context, sql,
+                insert_into(tabDepartment).set(tabDepartment.name = "Sales"));
+      sql += "; ";
+      serialize(context, sql, delete_from(tabDepartment).unconditionally());
+      assert_equality(
+          "INSERT INTO tab_department (name) VALUES ('Sales'); DELETE FROM "
+          "tab_department",
+          sql);
+    }
+
+    // blobs are written in hex notation
+    {
+      const auto blob = std::vector<std::uint8_t>{0x00, 0x7F, 0xAB, 0xFF};
+      assert_equality("X'007FABFF'", to_sql_string(context, blob));
+      assert_equality("X''", to_sql_string(context,
+                                           std::span<const std::uint8_t>{}));
+    }
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return -1;
+  }
+}
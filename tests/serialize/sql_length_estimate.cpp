@@ -0,0 +1,138 @@
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/case.h>
+#include <sqlpp20/clause/delete_from.h>
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/clause/update.h>
+#include <sqlpp20/clause/with.h>
+#include <sqlpp20/cte.h>
+#include <sqlpp20/function.h>
+#include <sqlpp20/name_tag.h>
+#include <sqlpp20/operator.h>
+#include <sqlpp20/parameter.h>
+#include <sqlpp20/sql_length_estimate.h>
+#include <sqlpp20_test/mock_db.h>
+#include <sqlpp20_test/tables/TabDepartment.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <vector>
+
+#include "assert_equality.h"
+
+using ::sqlpp::test::assert_equality;
+using ::sqlpp::test::mock_context_t;
+using test::tabDepartment;
+using test::tabPerson;
+
+namespace {
+SQLPP_CREATE_NAME_TAG(foo);
+
+// Without escaping and floating point values, the estimate is exact
+template <typename Statement>
+auto assert_exact_estimate(const Statement& s) {
+  const auto sql = to_sql_string_c(mock_context_t{}, s);
+  assert_equality(std::to_string(sql.size()),
+                  std::to_string(sql_length_estimate(mock_context_t{}, s)));
+}
+}  // namespace
+
+int main() {
+  try {
+    assert_exact_estimate(sqlpp::select(tabPerson.id, tabPerson.name)
+                              .from(tabPerson)
+                              .where(tabPerson.isManager and
+                                     tabPerson.name == "Mr. C++" and
+                                     tabPerson.id > -4711)
+                              .order_by(tabPerson.id.asc())
+                              .limit(10u)
+                              .offset(20u));
+    assert_exact_estimate(
+        sqlpp::select(tabPerson.id)
+            .from(tabPerson)
+            .where(in(tabPerson.id, 1, 22, 333, 4444, -55555)));
+    assert_exact_estimate(insert_into(tabPerson).set(
+        tabPerson.isManager = true, tabPerson.name = "Sample Name"));
+    assert_exact_estimate(update(tabPerson)
+                              .set(tabPerson.isManager = false)
+                              .where(tabPerson.id == 1000000));
+    assert_exact_estimate(
+        delete_from(tabPerson).where(tabPerson.id <= 1 + tabPerson.id));
+
+    // composite nodes
+    assert_exact_estimate(
+        sqlpp::select(
+            tabPerson.id.as(foo),
+            count(::sqlpp::distinct, tabPerson.id).as(tabPerson.language),
+            sqlpp::as(coalesce(tabPerson.name, tabPerson.language, "Herb"),
+                      tabPerson.name),
+            sqlpp::as(concat(tabPerson.name, "Herb"), tabPerson.address))
+            .from(tabPerson.join(tabDepartment)
+                      .on(tabPerson.id == tabDepartment.id)
+                      .left_outer_join(tabDepartment.as(foo))
+                      .unconditionally())
+            .where(tabPerson.id == sqlpp::parameter<std::int64_t>(tabPerson.id))
+            .group_by(tabPerson.id, tabPerson.name, tabPerson.language,
+                      tabPerson.address)
+            .having(max(tabPerson.id) > 17));
+    assert_exact_estimate(
+        sqlpp::case_when(tabPerson.id % 3 == 2, sqlpp::then(tabPerson.id > 7))
+            .when(tabPerson.id % 3 == 1, sqlpp::then(tabPerson.id > 9))
+            .else_(tabPerson.id > 17));
+    assert_exact_estimate(
+        sqlpp::with(cte(foo).as(sqlpp::select(all_of(tabPerson))
+                                    .from(tabPerson)
+                                    .where(tabPerson.id % 2 == 0)))
+        << sqlpp::select() << sqlpp::select_columns(tabPerson.id)
+        << sqlpp::from(tabPerson)
+        << sqlpp::where(tabPerson.isManager and tabPerson.name == ""));
+
+    // one reservation for many rows
+    {
+      auto rows = std::vector<std::tuple<decltype(tabDepartment.name = "")>>{};
+      for (auto i = 0; i < 1000; ++i) {
+        rows.emplace_back(tabDepartment.name = "Department");
+      }
+      assert_exact_estimate(insert_into(tabDepartment).multiset(rows));
+    }
+
+    // floating point values are not formatted for the estimate, but it is
+    // large enough for any value
+    {
+      const auto s = sqlpp::select(tabPerson.id)
+                         .from(tabPerson)
+                         .where(tabPerson.id < 0.30000000000000004);
+      if (sql_length_estimate(mock_context_t{}, s) <
+          to_sql_string_c(mock_context_t{}, s).size()) {
+        throw std::runtime_error("estimate too small for floating point value");
+      }
+    }
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return -1;
+  }
+}
@@ -0,0 +1,117 @@
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/operator.h>
+#include <sqlpp20/parameter.h>
+#include <sqlpp20/sql_string_cache.h>
+#include <sqlpp20_test/mock_db.h>
+#include <sqlpp20_test/tables/TabDepartment.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include <vector>
+
+#include "assert_equality.h"
+
+using ::sqlpp::test::assert_equality;
+using ::sqlpp::test::mock_context_t;
+using test::tabDepartment;
+using test::tabPerson;
+
+namespace {
+auto select_by_name(const std::string& name) {
+  return sqlpp::select(tabPerson.id).from(tabPerson).where(tabPerson.name ==
+                                                           name);
+}
+
+auto select_by_parameter() {
+  return sqlpp::select(tabPerson.id)
+      .from(tabPerson)
+      .where(tabPerson.name == sqlpp::parameter<std::string>(tabPerson.name));
+}
+
+using sqlpp::is_sql_string_cacheable_v;
+
+// Tables, columns and parameters do not carry runtime text
+static_assert(is_sql_string_cacheable_v<decltype(select_by_parameter())>);
+static_assert(is_sql_string_cacheable_v<decltype(
+                  sqlpp::select(tabPerson.id, tabPerson.name)
+                      .from(tabPerson.join(tabDepartment)
+                                .on(tabPerson.id == tabDepartment.id))
+                      .unconditionally())>);
+
+// Values, optional parts and rows do
+static_assert(not is_sql_string_cacheable_v<decltype(select_by_name(""))>);
+static_assert(not is_sql_string_cacheable_v<decltype(
+                  sqlpp::select(tabPerson.id).from(tabPerson).where(
+                      tabPerson.id == 17))>);
+static_assert(not is_sql_string_cacheable_v<decltype(
+                  sqlpp::select(tabPerson.id)
+                      .from(tabPerson)
+                      .unconditionally()
+                      .limit(1))>);
+static_assert(not is_sql_string_cacheable_v<decltype(
+                  sqlpp::select(tabPerson.id,
+                                std::make_optional(tabPerson.name))
+                      .from(tabPerson)
+                      .unconditionally())>);
+static_assert(not is_sql_string_cacheable_v<decltype(
+                  insert_into(tabDepartment)
+                      .multiset(std::vector{std::tuple{
+                          tabDepartment.name =
+                              sqlpp::parameter<std::string>(
+                                  tabDepartment.name)}}))>);
+}  // namespace
+
+int main() {
+  try {
+    // Cached text is serialized once and shared afterwards
+    {
+      const auto& first =
+          to_sql_string_cached(mock_context_t{}, select_by_parameter());
+      const auto& second =
+          to_sql_string_cached(mock_context_t{}, select_by_parameter());
+      assert_equality(
+          "SELECT tab_person.id FROM tab_person WHERE tab_person.name = ?",
+          first);
+      if (&first != &second) {
+        throw std::runtime_error("cached SQL text was serialized twice");
+      }
+    }
+
+    // Everything else is serialized on each call
+    assert_equality(
+        "SELECT tab_person.id FROM tab_person WHERE tab_person.name = 'a'",
+        to_sql_string_cached(mock_context_t{}, select_by_name("a")));
+    assert_equality(
+        "SELECT tab_person.id FROM tab_person WHERE tab_person.name = 'b'",
+        to_sql_string_cached(mock_context_t{}, select_by_name("b")));
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return -1;
+  }
+}
@@ -0,0 +1,110 @@
+/*
+Copyright (c) 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/clause/insert_into.h>
+#include <sqlpp20/clause/select.h>
+#include <sqlpp20/clause/update.h>
+#include <sqlpp20/operator.h>
+#include <sqlpp20/parameter.h>
+#include <sqlpp20/static_sql_string.h>
+#include <sqlpp20_test/mock_db.h>
+#include <sqlpp20_test/tables/TabDepartment.h>
+#include <sqlpp20_test/tables/TabPerson.h>
+
+#include "assert_equality.h"
+
+using ::sqlpp::static_sql_string_v;
+using ::sqlpp::test::assert_equality;
+using ::sqlpp::test::mock_context_t;
+using test::tabDepartment;
+using test::tabPerson;
+
+namespace test {
+struct count_context_t {
+  int parameter_index = 0;
+};
+}  // namespace test
+
+namespace sqlpp {
+template <typename ValueType, typename NameTag>
+constexpr auto serialize(::test::count_context_t& context, std::string& sql,
+                         const parameter_t<ValueType, NameTag>&) -> void {
+  sql += "$";
+  serialize(context, sql, ++context.parameter_index);
+}
+}  // namespace sqlpp
+
+namespace {
+constexpr auto select_by_name =
+    sqlpp::select(tabPerson.id, tabPerson.name)
+        .from(tabPerson)
+        .where(tabPerson.name ==
+                   sqlpp::parameter<std::string>(tabPerson.name) or
+               tabPerson.id < sqlpp::parameter<int64_t>(tabPerson.id));
+
+constexpr auto insert_department =
+    sqlpp::insert_into(tabDepartment)
+        .set(tabDepartment.name =
+                 sqlpp::parameter<std::string>(tabDepartment.name));
+
+constexpr auto update_department =
+    sqlpp::update(tabDepartment)
+        .set(tabDepartment.name =
+                 sqlpp::parameter<std::string>(tabDepartment.name))
+        .where(tabDepartment.id == sqlpp::parameter<int64_t>(tabDepartment.id));
+
+auto text(std::string_view sql) { return std::string{sql}; }
+
+// The text is a compile-time constant
+static_assert(std::string_view{
+                  static_sql_string_v<mock_context_t, insert_department>} ==
+              "INSERT INTO tab_department (name) VALUES (?)");
+static_assert(static_sql_string_v<test::count_context_t, select_by_name>
+                  .size() > 0);
+}  // namespace
+
+int main() {
+  try {
+    // The compile-time text matches the one generated at runtime
+    assert_equality(to_sql_string_c(mock_context_t{}, select_by_name),
+                    text(static_sql_string_v<mock_context_t, select_by_name>));
+    assert_equality(
+        to_sql_string_c(mock_context_t{}, update_department),
+        text(static_sql_string_v<mock_context_t, update_department>));
+
+    // Parameter numbering is done at compile time, too
+    assert_equality(
+        "SELECT tab_person.id, tab_person.name FROM tab_person WHERE "
+        "(tab_person.name = $1) OR (tab_person.id < $2)",
+        text(static_sql_string_v<test::count_context_t, select_by_name>));
+    assert_equality(
+        "UPDATE tab_department SET name = $1 WHERE tab_department.id = $2",
+        text(static_sql_string_v<test::count_context_t, update_department>));
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return -1;
+  }
+}
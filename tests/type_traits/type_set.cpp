@@ -0,0 +1,86 @@
+/*
+Copyright (c) 2016 - 2020, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp20/type_set.h>
+#include <sqlpp20/type_vector.h>
+
+using sqlpp::type_set;
+using sqlpp::type_set_union;
+using sqlpp::type_vector;
+using sqlpp::type_vector_cat_t;
+
+// construction removes duplicates
+static_assert(type_set<>().empty());
+static_assert(type_set<int, float, bool>().size() == 3);
+static_assert(type_set<int, float, int, bool, float>() ==
+              type_set<int, float, bool>());
+static_assert(type_set(1, 2.0, 3) == type_set<int, double>());
+
+// membership and comparison
+static_assert(type_set<int, float>().count<int>());
+static_assert(not type_set<int, float>().count<bool>());
+static_assert(type_set<int, float>() == type_set<float, int>());
+static_assert(type_set<int, float>() != type_set<int, float, bool>());
+static_assert(type_set<int, float>() <= type_set<int, float, bool>());
+static_assert(type_set<int>().is_disjoint_from(type_set<float, bool>()));
+static_assert(not type_set<int>().is_disjoint_from(type_set<float, int>()));
+
+// set algebra
+static_assert((type_set<int, float>() | type_set<float, bool>()) ==
+              type_set<int, float, bool>());
+static_assert((type_set<int, float>() & type_set<float, bool>()) ==
+              type_set<float>());
+static_assert((type_set<int, float>() - type_set<float, bool>()) ==
+              type_set<int>());
+static_assert(type_set<int, float>().remove<int>() == type_set<float>());
+
+// symmetric difference
+static_assert((type_set<int, float>() ^ type_set<float, bool>()) ==
+              type_set<int, bool>());
+static_assert((type_set<int, float>() ^ type_set<bool, char>()) ==
+              type_set<int, float, bool, char>());
+static_assert((type_set<int, float>() ^ type_set<float, int>()).empty());
+static_assert((type_set<int>() ^ type_set<int, float>()) == type_set<float>());
+static_assert((type_set<int, float>() ^ type_set<>()) ==
+              type_set<int, float>());
+static_assert((type_set<>() ^ type_set<int>()) == type_set<int>());
+
+// unions of many sets
+static_assert(type_set_union().empty());
+static_assert(type_set_union(type_set<int>(), type_set<float, int>(),
+                             type_set<>(), type_set<bool>(),
+                             type_set<float>()) ==
+              type_set<int, float, bool>());
+
+// concatenation of type vectors keeps order and duplicates
+static_assert(std::is_same_v<type_vector_cat_t<>, type_vector<>>);
+static_assert(
+    std::is_same_v<type_vector_cat_t<type_vector<int>, type_vector<>,
+                                     type_vector<float, int>, type_vector<bool>,
+                                     type_vector<char>>,
+                   type_vector<int, float, int, bool, char>>);
+
+int main() {}